@@ -10,8 +10,10 @@
 #define QUIVER_HPP_INCLUDED
 
 #include <quiver/adjacency_list.hpp>
+#include <quiver/apsp.hpp>
 #include <quiver/connected_components.hpp>
 #include <quiver/container_traits.hpp>
+#include <quiver/csr_graph.hpp>
 #include <quiver/disjoint_set.hpp>
 #include <quiver/dot.hpp>
 #include <quiver/exception.hpp>
@@ -24,6 +26,7 @@
 #include <quiver/regular.hpp>
 #include <quiver/search.hpp>
 #include <quiver/strongly_connected_components.hpp>
+#include <quiver/thread_pool.hpp>
 #include <quiver/toposort.hpp>
 #include <quiver/typedefs.hpp>
 #include <quiver/util.hpp>
@@ -16,13 +16,16 @@
 #include <utility>
 #include <cstddef>
 #include <algorithm>
+#include <ranges>
+#include <tuple>
 
 namespace quiver
 {
-	template<typename edge_properties_t>
+	template<typename edge_properties_t, typename index_t = vertex_index_t>
 	struct out_edge : public void2empty<edge_properties_t>
 	{
 		using base_t = void2empty<edge_properties_t>;
+		using vertex_index_t = index_t;
 		vertex_index_t to;
 
 		base_t const& properties() const noexcept	{ return *this; }
@@ -34,10 +37,11 @@ namespace quiver
 		{
 		}
 	};
-	template<typename edge_properties_t>
+	template<typename edge_properties_t, typename index_t = vertex_index_t>
 	struct edge : public void2empty<edge_properties_t>
 	{
 		using base_t = void2empty<edge_properties_t>;
+		using vertex_index_t = index_t;
 		vertex_index_t from, to;
 
 		base_t const& properties() const noexcept	{ return *this; }
@@ -48,7 +52,7 @@ namespace quiver
 		: base_t(std::forward<args_t>(args)...), from(from), to(to)
 		{
 		}
-		constexpr edge(vertex_index_t from, out_edge<edge_properties_t> out) noexcept(std::is_nothrow_move_constructible_v<base_t>)
+		constexpr edge(vertex_index_t from, out_edge<edge_properties_t, index_t> out) noexcept(std::is_nothrow_move_constructible_v<base_t>)
 		: base_t(std::move(out.properties())), from(from), to(out.to)
 		{
 		}
@@ -88,6 +92,16 @@ namespace quiver
 
 	namespace detail
 	{
+		// invokes invokable(from, to, properties...) for an edge or a tuple-like (from, to, properties...)
+		template<typename edge_t, typename invokable_t>
+		constexpr decltype(auto) apply_to_edge(edge_t&& edge, invokable_t&& invokable)
+		{
+			if constexpr(requires { edge.from; edge.to; edge.properties(); })
+				return std::forward<invokable_t>(invokable)(edge.from, edge.to, std::forward<edge_t>(edge).properties());
+			else
+				return std::apply(std::forward<invokable_t>(invokable), std::forward<edge_t>(edge));
+		}
+
 		template<typename adjacency_list_t, typename intermediate_t>
 		class vertex_span_t final
 		{
@@ -196,6 +210,7 @@ namespace quiver
 			typename vertex_properties_t,
 			template<typename> class out_edge_container,
 			template<typename> class vertex_container,
+			typename index_t,
 			typename derived_t
 		>
 		class adjacency_list_base
@@ -205,11 +220,12 @@ namespace quiver
 				typename rhs_vertex_properties_t,
 				template<typename> class rhs_out_edge_container,
 				template<typename> class rhs_vertex_container,
+				typename rhs_index_t,
 				typename rhs_derived_t
 			>
 			friend class adjacency_list_base;
 
-			using vertices_t = vertex_container<::quiver::vertex<vertex_properties_t, out_edge_container<out_edge<edge_properties_t>>>>;
+			using vertices_t = vertex_container<::quiver::vertex<vertex_properties_t, out_edge_container<out_edge<edge_properties_t, index_t>>>>;
 			using adjacency_list = derived_t;
 			using vertex_span_type = vertex_span_t<adjacency_list, adjacency_list_base>;
 			friend vertex_span_type;
@@ -249,7 +265,7 @@ namespace quiver
 				template<typename> class rhs_vertex_container,
 				typename rhs_derived_t
 			>
-			adjacency_list_base(adjacency_list_base<rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container, rhs_derived_t> const& rhs)
+			adjacency_list_base(adjacency_list_base<rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container, index_t, rhs_derived_t> const& rhs)
 			: m_v(rhs.m_v), m_e(rhs.m_e), m_vertices(rhs.m_vertices)
 			{
 			}
@@ -260,7 +276,7 @@ namespace quiver
 				template<typename> class rhs_vertex_container,
 				typename rhs_derived_t
 			>
-			adjacency_list_base(adjacency_list_base<rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container, rhs_derived_t>&& rhs) noexcept
+			adjacency_list_base(adjacency_list_base<rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container, index_t, rhs_derived_t>&& rhs) noexcept
 			: m_v(std::move(rhs.m_v)), m_e(std::move(rhs.m_e)), m_vertices(std::move(rhs.m_vertices))
 			{
 			}
@@ -280,29 +296,38 @@ namespace quiver
 	}
 
 	// no loops, no multiedges
+	// index_t is the type used to store vertex indices. A narrower type than std::size_t
+	// shrinks every out-edge, e.g. to 8 instead of 16 bytes with a wt<float> and std::uint32_t.
 	template<
 		directivity_t dir = directed,
 		typename edge_properties_t = void,
 		typename vertex_properties_t = void,
 		template<typename> class out_edge_container = vector,
-		template<typename> class vertex_container = vector
+		template<typename> class vertex_container = vector,
+		typename index_t = vertex_index_t
 	>
-	class adjacency_list : private detail::adjacency_list_base<edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>>
+	class adjacency_list : private detail::adjacency_list_base<edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>>
 	{
+	public:
+		using vertex_index_t = index_t;
+		static_assert(std::is_unsigned_v<vertex_index_t>, "vertex_index_t must be an unsigned integer type");
+
+	private:
 		template<
 			directivity_t rhs_dir,
 			typename rhs_edge_properties_t,
 			typename rhs_vertex_properties_t,
 			template<typename> class rhs_out_edge_container,
-			template<typename> class rhs_vertex_container
+			template<typename> class rhs_vertex_container,
+			typename rhs_index_t
 		>
 		friend class adjacency_list;
 
-		using base_t = detail::adjacency_list_base<edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, adjacency_list>;
+		using base_t = detail::adjacency_list_base<edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, adjacency_list>;
 
 	public:
-		using edge_t = edge<edge_properties_t>;
-		using out_edge_t = out_edge<edge_properties_t>;
+		using edge_t = edge<edge_properties_t, index_t>;
+		using out_edge_t = out_edge<edge_properties_t, index_t>;
 		using out_edge_list_t = out_edge_container<out_edge_t>;
 		static_assert(is_sane_container<out_edge_list_t>, "out_edge_list_t must be sane container");
 
@@ -320,7 +345,7 @@ namespace quiver
 			template<typename> class rhs_out_edge_container,
 			template<typename> class rhs_vertex_container
 		>
-		explicit adjacency_list(adjacency_list<rhs_dir, rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container> const& rhs);
+		explicit adjacency_list(adjacency_list<rhs_dir, rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container, index_t> const& rhs);
 		template<
 			directivity_t rhs_dir,
 			typename rhs_edge_properties_t,
@@ -328,7 +353,7 @@ namespace quiver
 			template<typename> class rhs_out_edge_container,
 			template<typename> class rhs_vertex_container
 		>
-		explicit adjacency_list(adjacency_list<rhs_dir, rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container>&& rhs) noexcept;
+		explicit adjacency_list(adjacency_list<rhs_dir, rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container, index_t>&& rhs) noexcept;
 
 		using base_t::m_v;
 		static_assert(std::is_same_v<decltype(m_v), std::size_t>);
@@ -380,6 +405,11 @@ namespace quiver
 	public:
 		adjacency_list() noexcept = default;
 		explicit adjacency_list(std::size_t vertices);
+		// Bulk construction from a range of edges, each either an edge_t or a tuple-like (from, to, properties...).
+		// Undirected edges are mirrored and duplicates are dropped, keeping the first occurrence like E.emplace does.
+		// time complexity:  O(E + V)
+		template<std::ranges::forward_range edges_t>
+		adjacency_list(std::size_t vertices, edges_t const& edges);
 
 		using vertex_span_type = detail::vertex_span_t<adjacency_list, base_t>;
 		friend vertex_span_type;
@@ -398,11 +428,11 @@ namespace quiver
 		adjacency_list strip_edges() const&;
 		adjacency_list&& strip_edges() &&;
 
-		adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> to_directed() const&;
-		adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> to_directed() &&;
+		adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> to_directed() const&;
+		adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> to_directed() &&;
 
-		adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> to_undirected() const&;
-		adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> to_undirected() &&;
+		adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> to_undirected() const&;
+		adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> to_undirected() &&;
 
 		template<typename invokable_t>
 		void transform_outs(invokable_t invokable);
@@ -418,8 +448,8 @@ namespace quiver
 		static constexpr bool is_simple() noexcept;
 	};
 
-	template<directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-	void swap(adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> const& lhs, adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> const& rhs) noexcept;
+	template<directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+	void swap(adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> const& lhs, adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> const& rhs) noexcept;
 }
 
 #include <quiver/adjacency_list.inl>
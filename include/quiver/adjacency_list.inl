@@ -13,103 +13,105 @@
 #include <quiver/properties.hpp>
 #include <quiver/container_traits.hpp>
 #include <utility>
+#include <algorithm>
+#include <vector>
 #include <cassert>
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
 template<quiver::directivity_t rhs_dir, typename rhs_edge_properties_t, typename rhs_vertex_properties_t, template<typename> class rhs_out_edge_container, template<typename> class rhs_vertex_container>
-quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::adjacency_list(adjacency_list<rhs_dir, rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container> const& rhs)
+quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::adjacency_list(adjacency_list<rhs_dir, rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container, index_t> const& rhs)
 : base_t(rhs)
 {
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
 template<quiver::directivity_t rhs_dir, typename rhs_edge_properties_t, typename rhs_vertex_properties_t, template<typename> class rhs_out_edge_container, template<typename> class rhs_vertex_container>
-quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::adjacency_list(adjacency_list<rhs_dir, rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container>&& rhs) noexcept
+quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::adjacency_list(adjacency_list<rhs_dir, rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container, index_t>&& rhs) noexcept
 : base_t(std::move(rhs))
 {
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::normalize(vertex_index_t& from, vertex_index_t& to) noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::normalize(vertex_index_t& from, vertex_index_t& to) noexcept
 {
 	if(from > to)
 		std::swap(from, to);
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_size() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::vertex_size() const noexcept
 {
 	return m_vertices.size();
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_empty() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::vertex_empty() const noexcept
 {
 	return V.size() == 0;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_capacity() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::vertex_capacity() const noexcept
 {
 	return m_vertices.capacity();
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_reserve(std::size_t vertices)
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::vertex_reserve(std::size_t vertices)
 {
 	m_vertices.reserve(vertices);
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_begin() noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::vertex_begin() noexcept
 {
 	return m_vertices.begin();
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_begin() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::vertex_begin() const noexcept
 {
 	return m_vertices.begin();
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_cbegin() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::vertex_cbegin() const noexcept
 {
 	return m_vertices.cbegin();
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_end() noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::vertex_end() noexcept
 {
 	return m_vertices.end();
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_end() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::vertex_end() const noexcept
 {
 	return m_vertices.end();
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_cend() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::vertex_cend() const noexcept
 {
 	return m_vertices.cend();
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_get(vertex_index_t index) const noexcept -> vertex_t const&
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::vertex_get(vertex_index_t index) const noexcept -> vertex_t const&
 {
 	assert(index < V.size());
 	return m_vertices[index];
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_get(vertex_index_t index) noexcept -> vertex_t&
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::vertex_get(vertex_index_t index) noexcept -> vertex_t&
 {
 	return const_cast<vertex_t&>(static_cast<adjacency_list const&>(*this).vertex_get(index));
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
 template<typename... args_t>
-quiver::vertex_index_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_emplace(args_t&&... args)
+auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::vertex_emplace(args_t&&... args) -> vertex_index_t
 {
 	m_vertices.emplace_back(std::forward<args_t>(args)...);
 	// assert(directivity == directed || m_vertices.back().out_edges.empty()); // we mustn't have this check for split_ccs
 	m_e += m_vertices.back().out_edges.size();
 	return m_v++;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_erase(vertex_index_t index)
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::vertex_erase(vertex_index_t index)
 {
 	assert(index < V.size());
 
@@ -138,8 +140,8 @@ bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 		return false;
 	}
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_erase_simple(vertex_index_t index)
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::vertex_erase_simple(vertex_index_t index)
 {
 	assert(index < V.size());
 
@@ -150,21 +152,21 @@ bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 	return true;
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_size() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::edge_size() const noexcept
 {
 	if constexpr(directivity == directed)
 		return m_e;
 	else if constexpr(directivity == undirected)
 		return m_e / 2;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_empty() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::edge_empty() const noexcept
 {
 	return E.size() == 0;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_max_size() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::edge_max_size() const noexcept
 {
 	if constexpr(directivity == directed)
 		return V.size() * (V.size() - 1);
@@ -172,8 +174,8 @@ constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_prop
 		return V.size() * (V.size() - 1) / 2;
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_get(vertex_index_t from, vertex_index_t to) const noexcept -> out_edge_t const*
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::edge_get(vertex_index_t from, vertex_index_t to) const noexcept -> out_edge_t const*
 {
 	assert(from < V.size());
 	assert(to < V.size());
@@ -182,8 +184,8 @@ constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_
 		normalize(from, to); // so that edge_get(1,0) == edge_get(0,1)
 	return edge_get_simple(from, to);
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_get_simple(vertex_index_t from, vertex_index_t to) const noexcept -> out_edge_t const*
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::edge_get_simple(vertex_index_t from, vertex_index_t to) const noexcept -> out_edge_t const*
 {
 	assert(from < V.size());
 	assert(to < V.size());
@@ -196,9 +198,9 @@ constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_
 	return nullptr;
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
 template<typename... args_t>
-bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_emplace(vertex_index_t from, vertex_index_t to, args_t&&... args)
+bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::edge_emplace(vertex_index_t from, vertex_index_t to, args_t&&... args)
 {
 	assert(from < V.size());
 	assert(to < V.size());
@@ -215,9 +217,9 @@ bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 	}
 	return true;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
 template<typename... args_t>
-bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_emplace_simple_nonexistent(vertex_index_t from, vertex_index_t to, args_t&&... args)
+bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::edge_emplace_simple_nonexistent(vertex_index_t from, vertex_index_t to, args_t&&... args)
 {
 	assert(from < V.size());
 	assert(to < V.size());
@@ -228,9 +230,9 @@ bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 	++m_e;
 	return true;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
 template<typename... args_t>
-bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_emplace_simple(vertex_index_t from, vertex_index_t to, args_t&&... args)
+bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::edge_emplace_simple(vertex_index_t from, vertex_index_t to, args_t&&... args)
 {
 	assert(from < V.size());
 	assert(to < V.size());
@@ -241,8 +243,8 @@ bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 	else
 		return false;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_erase(vertex_index_t from, vertex_index_t to)
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::edge_erase(vertex_index_t from, vertex_index_t to)
 {
 	assert(from < V.size());
 	assert(to < V.size());
@@ -261,8 +263,8 @@ bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 		return removed;
 	}
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_erase_simple(vertex_index_t from, vertex_index_t to)
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::edge_erase_simple(vertex_index_t from, vertex_index_t to)
 {
 	assert(from < V.size());
 	assert(to < V.size());
@@ -281,14 +283,57 @@ bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 	return false;
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::adjacency_list(std::size_t vertices)
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::adjacency_list(std::size_t vertices)
 : base_t(vertices)
 {
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::in_degree(vertex_index_t index) const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+template<std::ranges::forward_range edges_t>
+quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::adjacency_list(std::size_t vertices, edges_t const& edges)
+: base_t(vertices)
+{
+	// count the degrees so that every out-edge list is allocated exactly once
+	if constexpr(requires(out_edge_list_t& out_edges) { out_edges.reserve(std::size_t{}); }) {
+		std::vector<std::size_t> degrees(vertices, 0);
+		for(auto const& edge : edges)
+			detail::apply_to_edge(edge, [&degrees](vertex_index_t from, vertex_index_t to, auto const&...) {
+				++degrees[from];
+				if constexpr(directivity == undirected)
+					++degrees[to];
+			});
+		for(vertex_index_t v = 0; v < vertices; ++v)
+			m_vertices[v].out_edges.reserve(degrees[v]);
+	}
+
+	for(auto const& edge : edges)
+		detail::apply_to_edge(edge, [this](vertex_index_t from, vertex_index_t to, auto const&... args) {
+			assert(from < V.size());
+			assert(to < V.size());
+			assert(from != to); // no loops
+
+			if constexpr(directivity == undirected)
+				m_vertices[to].out_edges.emplace_back(from, args...);
+			m_vertices[from].out_edges.emplace_back(to, args...);
+		});
+
+	// drop all but the first occurrence of every edge; last_from[w] == v iff v -> w has already been seen
+	std::vector<vertex_index_t> last_from(vertices, ~vertex_index_t{});
+	for(vertex_index_t v = 0; v < vertices; ++v) {
+		auto& out_edges = m_vertices[v].out_edges;
+		out_edges.erase(std::remove_if(out_edges.begin(), out_edges.end(), [&last_from, v](out_edge_t const& out_edge) {
+			if(last_from[out_edge.to] == v)
+				return true;
+			last_from[out_edge.to] = v;
+			return false;
+		}), out_edges.end());
+		m_e += out_edges.size();
+	}
+}
+
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::in_degree(vertex_index_t index) const noexcept
 {
 	if constexpr(directivity == directed) {
 		std::size_t count = 0;
@@ -299,20 +344,20 @@ std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t,
 		return out_degree(index);
 	}
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::out_degree(vertex_index_t index) const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::out_degree(vertex_index_t index) const noexcept
 {
 	return V[index].out_degree();
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::degree(vertex_index_t index) const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::degree(vertex_index_t index) const noexcept
 {
 	static_assert(directivity == undirected, "degree only defined for undirected graphs");
 	return out_degree(index);
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::strip_edges() const& -> adjacency_list
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::strip_edges() const& -> adjacency_list
 {
 	adjacency_list result;
 	result.V.reserve(V.size());
@@ -320,8 +365,8 @@ auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 		result.V.emplace(vertex.properties());
 	return result;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::strip_edges() && -> adjacency_list&&
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::strip_edges() && -> adjacency_list&&
 {
 	for(auto& vertex : m_vertices) {
 		std::size_t diff_e = vertex.out_edges.size();
@@ -332,23 +377,23 @@ auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 	return std::move(*this);
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::to_directed() const& -> adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::to_directed() const& -> adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>
 {
-	using result_t = adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>;
+	using result_t = adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>;
 	return result_t(*this);
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::to_directed() && -> adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::to_directed() && -> adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>
 {
-	using result_t = adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>;
+	using result_t = adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>;
 	return result_t(std::move(*this));
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::to_undirected() const& -> adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::to_undirected() const& -> adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>
 {
-	using result_t = adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>;
+	using result_t = adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>;
 	if constexpr(directivity == directed)
 	{
 		// TODO: enforce that there are no back and forths in the original directed graph. this can be caught by checking emplace's return value
@@ -366,10 +411,10 @@ auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 		return *this;
 	}
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::to_undirected() && -> adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::to_undirected() && -> adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>
 {
-	using result_t = adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>;
+	using result_t = adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>;
 	if constexpr(directivity == directed)
 	{
 		// TODO: enforce that there are no back and forths in the original directed graph
@@ -385,24 +430,24 @@ auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 	}
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
 template<typename invokable_t>
-void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::transform_outs(invokable_t invokable)
+void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::transform_outs(invokable_t invokable)
 {
 	for(auto& vertex : m_vertices)
 		for(auto& out_edge : vertex.out_edges)
 			out_edge.to = invokable(out_edge.to);
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::sort_edges()
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::sort_edges()
 {
 	if constexpr(container_traits<out_edge_list_t>::is_ordered)
 		for(auto& vertex : m_vertices)
 			vertex.sort_edges();
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::contract(vertex_index_t u, vertex_index_t v)
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::contract(vertex_index_t u, vertex_index_t v)
 {
 	// TODO: this function currently doesn't provide strong exception safety
 
@@ -481,8 +526,8 @@ bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 
 	return has_uv_or_vu;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-quiver::vertex_index_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::cleave(vertex_index_t v)
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::cleave(vertex_index_t v) -> vertex_index_t
 {
 	assert(v < V.size());
 
@@ -498,8 +543,8 @@ quiver::vertex_index_t quiver::adjacency_list<dir, edge_properties_t, vertex_pro
 	return new_v;
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::swap(adjacency_list& rhs) noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::swap(adjacency_list& rhs) noexcept
 {
 	using std::swap;
 	swap(m_vertices, rhs.m_vertices);
@@ -507,19 +552,19 @@ void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 	swap(m_e, rhs.m_e);
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::is_weighted() noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::is_weighted() noexcept
 {
 	return is_weighted_v<adjacency_list>;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::is_simple() noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+constexpr bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>::is_simple() noexcept
 {
 	return !is_weighted() && directivity == undirected;
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-void quiver::swap(adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> const& lhs, adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> const& rhs) noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+void quiver::swap(adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> const& lhs, adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> const& rhs) noexcept
 {
 	lhs.swap(rhs);
 }
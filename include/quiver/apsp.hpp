@@ -0,0 +1,14 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_APSP_HPP_INCLUDED
+#define QUIVER_APSP_HPP_INCLUDED
+
+#include <quiver/apsp/floyd_warshall.hpp>
+#include <quiver/apsp/johnson.hpp>
+
+#endif // !QUIVER_APSP_HPP_INCLUDED
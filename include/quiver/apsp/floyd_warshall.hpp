@@ -0,0 +1,257 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_APSP_FLOYD_WARSHALL_HPP_INCLUDED
+#define QUIVER_APSP_FLOYD_WARSHALL_HPP_INCLUDED
+
+#include <quiver/search/bellman_ford.hpp>
+#include <quiver/search/dijkstra.hpp>
+#include <quiver/search/many_to_many.hpp>
+#include <quiver/adjacency_list.hpp>
+#include <quiver/thread_pool.hpp>
+#include <quiver/exception.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <ranges>
+#include <limits>
+#include <vector>
+#include <span>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace quiver
+{
+	// The distance of missing edges in the matrices of floyd_warshall_in_place.
+	// Integers use half the maximum, so that the sum of two of them cannot overflow.
+	template<typename scalar_t>
+	inline constexpr scalar_t floyd_warshall_inf = std::numeric_limits<scalar_t>::has_infinity ? std::numeric_limits<scalar_t>::infinity() : std::numeric_limits<scalar_t>::max() / 2;
+
+	namespace detail
+	{
+		inline constexpr std::size_t floyd_warshall_block_size = 64;
+
+		// c[j] = min(c[j], a + b[j]) for j in [0, n)
+		template<typename scalar_t>
+		void min_plus_row(scalar_t* __restrict c, scalar_t const* __restrict b, scalar_t a, std::size_t n) noexcept
+		{
+			std::size_t j = 0;
+#ifdef __AVX2__
+			if constexpr(std::is_same_v<scalar_t, std::int32_t>) {
+				const __m256i va = _mm256_set1_epi32(a);
+				for(; j + 8 <= n; j += 8) {
+					const __m256i vb = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(b + j));
+					const __m256i vc = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(c + j));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(c + j), _mm256_min_epi32(vc, _mm256_add_epi32(va, vb)));
+				}
+			} else if constexpr(std::is_same_v<scalar_t, float>) {
+				const __m256 va = _mm256_set1_ps(a);
+				for(; j + 8 <= n; j += 8)
+					_mm256_storeu_ps(c + j, _mm256_min_ps(_mm256_loadu_ps(c + j), _mm256_add_ps(va, _mm256_loadu_ps(b + j))));
+			} else if constexpr(std::is_same_v<scalar_t, double>) {
+				const __m256d va = _mm256_set1_pd(a);
+				for(; j + 4 <= n; j += 4)
+					_mm256_storeu_pd(c + j, _mm256_min_pd(_mm256_loadu_pd(c + j), _mm256_add_pd(va, _mm256_loadu_pd(b + j))));
+			}
+#endif
+			for(; j < n; ++j)
+				c[j] = std::min(c[j], static_cast<scalar_t>(a + b[j]));
+		}
+		// The same, also taking over the predecessors of the improved entries.
+		template<typename scalar_t, typename index_t>
+		void min_plus_row(scalar_t* __restrict c, index_t* __restrict c_predecessors, scalar_t const* __restrict b, index_t const* __restrict b_predecessors, scalar_t a, std::size_t n) noexcept
+		{
+			for(std::size_t j = 0; j < n; ++j) {
+				const scalar_t candidate = a + b[j];
+				if(candidate < c[j]) {
+					c[j] = candidate;
+					c_predecessors[j] = b_predecessors[j];
+				}
+			}
+		}
+
+		// Relaxes block (ib, jb) over the intermediate vertices of block kb. The k loop is outermost,
+		// so the blocks of the diagonal, row kb and column kb can be updated in place.
+		template<typename scalar_t, typename index_t>
+		void floyd_warshall_block(scalar_t* distances, index_t* predecessors, std::size_t V, std::size_t ib, std::size_t jb, std::size_t kb) noexcept
+		{
+			constexpr std::size_t B = floyd_warshall_block_size;
+			const std::size_t i_end = std::min(V, (ib + 1) * B), j_begin = jb * B, k_end = std::min(V, (kb + 1) * B);
+			const std::size_t n = std::min(V, (jb + 1) * B) - j_begin;
+			for(std::size_t k = kb * B; k < k_end; ++k)
+				for(std::size_t i = ib * B; i < i_end; ++i) {
+					// row k relaxed by itself would alias the __restrict rows; d[k][k] is 0 unless on a negative cycle,
+					// which still shows on the diagonal through the other rows
+					if(i == k)
+						continue;
+					const scalar_t a = distances[i * V + k];
+					if(a == floyd_warshall_inf<scalar_t>)
+						continue;
+					if(predecessors)
+						min_plus_row(distances + i * V + j_begin, predecessors + i * V + j_begin, distances + k * V + j_begin, predecessors + k * V + j_begin, a, n);
+					else
+						min_plus_row(distances + i * V + j_begin, distances + k * V + j_begin, a, n);
+				}
+		}
+
+		template<typename scalar_t, typename index_t>
+		void basic_floyd_warshall(scalar_t* distances, index_t* predecessors, std::size_t V, thread_pool& pool)
+		{
+			constexpr std::size_t B = floyd_warshall_block_size;
+			const std::size_t blocks = (V + B - 1) / B;
+			for(std::size_t kb = 0; kb < blocks; ++kb) {
+				// the diagonal block, then the rest of its row and column, then everything else
+				floyd_warshall_block(distances, predecessors, V, kb, kb, kb);
+				pool.for_each(2 * blocks, [&](std::size_t, std::size_t task){
+					const std::size_t block = task / 2;
+					if(block == kb)
+						return;
+					if(task % 2 == 0)
+						floyd_warshall_block(distances, predecessors, V, kb, block, kb);
+					else
+						floyd_warshall_block(distances, predecessors, V, block, kb, kb);
+				});
+				pool.for_each(blocks * blocks, [&](std::size_t, std::size_t task){
+					const std::size_t ib = task / blocks, jb = task % blocks;
+					if(ib != kb && jb != kb)
+						floyd_warshall_block(distances, predecessors, V, ib, jb, kb);
+				});
+			}
+		}
+	}
+
+	// Floyd-Warshall on a row-major V x V matrix, in blocks of 64 x 64 that stay in cache.
+	// Each round settles the diagonal block, then its row and column blocks, then all other blocks,
+	// with the blocks of the last two phases distributed over pool.
+	// Missing edges shall be floyd_warshall_inf<scalar_t> and the diagonal 0. Afterwards, unreachable pairs are
+	// floyd_warshall_inf for floating point; with negative integer weights, they may drift below it by at most
+	// the sum of the negative weights.
+	// Negative cycles show as negative diagonal entries; the other distances are meaningless then.
+	// time complexity:  O(V^3) / threads
+	template<typename scalar_t>
+	void floyd_warshall_in_place(std::span<scalar_t> distances, std::size_t V, thread_pool& pool)
+	{
+		assert(distances.size() == V * V);
+		detail::basic_floyd_warshall<scalar_t, vertex_index_t>(distances.data(), nullptr, V, pool);
+	}
+	// predecessors[i * V + j] shall be i for the edges i -> j and i == j; it becomes the predecessor of j on a shortest path from i.
+	template<typename scalar_t, typename index_t>
+	void floyd_warshall_in_place(std::span<scalar_t> distances, std::span<index_t> predecessors, std::size_t V, thread_pool& pool)
+	{
+		assert(distances.size() == V * V);
+		assert(predecessors.size() == V * V);
+		detail::basic_floyd_warshall(distances.data(), predecessors.data(), V, pool);
+	}
+
+	namespace detail
+	{
+		template<typename graph_t, typename weight_invokable_t>
+		auto floyd_warshall_matrix(graph_t const& graph, weight_invokable_t weight_invokable, std::vector<vertex_index_type<graph_t>>* predecessors)
+		{
+			using out_edge_t = typename graph_t::out_edge_t;
+			using scalar_t = dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>>;
+			using vertex_index_t = vertex_index_type<graph_t>;
+			constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
+
+			const std::size_t V = graph.V.size();
+			distance_matrix<scalar_t> result(V, V);
+			std::ranges::fill(result.data(), floyd_warshall_inf<scalar_t>);
+			if(predecessors)
+				predecessors->assign(V * V, no_predecessor);
+			for(std::size_t from = 0; from < V; ++from) {
+				result(from, from) = scalar_t(0);
+				if(predecessors)
+					(*predecessors)[from * V + from] = static_cast<vertex_index_t>(from);
+				for(out_edge_t const& edge : graph.V[from].out_edges) {
+					const scalar_t weight = weight_invokable(from, edge);
+					if(weight < result(from, edge.to)) {
+						result(from, edge.to) = weight;
+						if(predecessors)
+							(*predecessors)[from * V + edge.to] = static_cast<vertex_index_t>(from);
+					}
+				}
+			}
+			return result;
+		}
+		template<typename graph_t, typename weight_invokable_t, typename scalar_t>
+		void floyd_warshall_finish(graph_t const& graph, weight_invokable_t weight_invokable, distance_matrix<scalar_t>& result, std::vector<vertex_index_type<graph_t>>* predecessors)
+		{
+			const std::size_t V = graph.V.size();
+			for(std::size_t index = 0; index < V; ++index)
+				if(result(index, index) < scalar_t(0)) {
+					const auto cycle = detail::basic_bellman_ford(graph, std::ranges::single_view(static_cast<vertex_index_type<graph_t>>(index)), widened_weight_invokable<graph_t>(weight_invokable)).second;
+					detail::throw_negative_cycle("floyd_warshall: negative cycle", cycle);
+				}
+			// see floyd_warshall_in_place for the drift of the integer infinity
+			const scalar_t unreachable = std::is_floating_point_v<scalar_t> ? floyd_warshall_inf<scalar_t> : floyd_warshall_inf<scalar_t> / 2;
+			const std::span<scalar_t> distances = result.data();
+			for(std::size_t i = 0; i < distances.size(); ++i)
+				if(!(distances[i] < unreachable)) {
+					distances[i] = inf<scalar_t>;
+					if(predecessors)
+						(*predecessors)[i] = ~vertex_index_type<graph_t>{};
+				}
+		}
+	}
+
+	// All pairs shortest paths of a dense graph with floyd_warshall_in_place.
+	// Return type is a distance_matrix of dijkstra_distance_t<scalar_t> with inf for unreachable pairs.
+	// Integer distances shall stay within a quarter of the range of that type.
+	// Throws negative_cycle if graph contains a negative cycle.
+	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t).
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto floyd_warshall(graph_t const& graph, weight_invokable_t weight_invokable, thread_pool& pool)
+	{
+		auto result = detail::floyd_warshall_matrix(graph, weight_invokable, nullptr);
+		floyd_warshall_in_place(result.data(), graph.V.size(), pool);
+		detail::floyd_warshall_finish(graph, weight_invokable, result, nullptr);
+		return result;
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto floyd_warshall(graph_t const& graph, thread_pool& pool)
+	{
+		return floyd_warshall(graph, dijkstra_default_weight_invokable<graph_t>(), pool);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto floyd_warshall(graph_t const& graph)
+	{
+		thread_pool pool;
+		return floyd_warshall(graph, pool);
+	}
+
+	// Return type is (distance_matrix, predecessors), where predecessors[i * V + j] is the predecessor of j
+	// on a shortest path from i, or ~vertex_index_t{} if j is unreachable from i.
+	// Otherwise the same as floyd_warshall.
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto floyd_warshall_shortest_path(graph_t const& graph, weight_invokable_t weight_invokable, thread_pool& pool)
+	{
+		const std::size_t V = graph.V.size();
+		std::vector<vertex_index_type<graph_t>> predecessors;
+		auto result = detail::floyd_warshall_matrix(graph, weight_invokable, &predecessors);
+		floyd_warshall_in_place(result.data(), std::span(predecessors), V, pool);
+		detail::floyd_warshall_finish(graph, weight_invokable, result, &predecessors);
+		return std::pair(std::move(result), std::move(predecessors));
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto floyd_warshall_shortest_path(graph_t const& graph, thread_pool& pool)
+	{
+		return floyd_warshall_shortest_path(graph, dijkstra_default_weight_invokable<graph_t>(), pool);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto floyd_warshall_shortest_path(graph_t const& graph)
+	{
+		thread_pool pool;
+		return floyd_warshall_shortest_path(graph, pool);
+	}
+}
+
+#endif // !QUIVER_APSP_FLOYD_WARSHALL_HPP_INCLUDED
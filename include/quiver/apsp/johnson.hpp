@@ -0,0 +1,107 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_APSP_JOHNSON_HPP_INCLUDED
+#define QUIVER_APSP_JOHNSON_HPP_INCLUDED
+
+#include <quiver/search/bellman_ford.hpp>
+#include <quiver/search/dijkstra.hpp>
+#include <quiver/search/many_to_many.hpp>
+#include <quiver/search/search_workspace.hpp>
+#include <quiver/adjacency_list.hpp>
+#include <quiver/thread_pool.hpp>
+#include <quiver/exception.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <ranges>
+#include <vector>
+#include <span>
+#include <utility>
+#include <cstddef>
+#include <cassert>
+
+namespace quiver
+{
+	// Johnson's all pairs shortest paths for sparse graphs with negative weights.
+	// One Bellman-Ford pass from a virtual source computes potentials h with w(u, v) + h(u) - h(v) >= 0,
+	// then one Dijkstra per source on the reweighted edges runs on pool, every thread with its own heap and workspace.
+	// row_callback shall have the signature void(vertex_index_t source, std::span<dijkstra_distance_t<scalar_t> const> distances)
+	// and is invoked once per source with the distances to all vertices, inf if unreachable.
+	// It is invoked concurrently from the threads of pool and the span is only valid during the call.
+	// Throws negative_cycle if graph contains a negative cycle.
+	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t).
+	// time complexity:  O(V * E + V * (E + V) * log(V)) / threads
+	template<typename graph_t, typename weight_invokable_t, typename row_callback_t>
+	void johnson_all_pairs(graph_t const& graph, weight_invokable_t narrow_weight_invokable, thread_pool& pool, row_callback_t row_callback)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>>;
+		using vertex_index_t = vertex_index_type<graph_t>;
+		const auto weight_invokable = detail::widened_weight_invokable<graph_t>(narrow_weight_invokable);
+
+		const std::size_t V = graph.V.size();
+		auto [potentials, cycle] = detail::basic_bellman_ford(graph, std::views::iota(vertex_index_t(0), static_cast<vertex_index_t>(V)), weight_invokable);
+		if(!cycle.empty())
+			detail::throw_negative_cycle("johnson_all_pairs: negative cycle", cycle);
+		// non-negative up to rounding, which must not make Dijkstra see a negative weight
+		const auto reweighted = [&potentials, &weight_invokable](vertex_index_t from, out_edge_t const& edge) -> scalar_t {
+			return std::max(scalar_t(0), static_cast<scalar_t>(weight_invokable(from, edge) + potentials[from].first - potentials[edge.to].first));
+		};
+
+		struct thread_state_t
+		{
+			search_workspace<vertex_index_t> workspace;
+			std::vector<scalar_t> row;
+		};
+		std::vector<thread_state_t> states(pool.size());
+		pool.for_each(V, [&](std::size_t thread_index, std::size_t source){
+			thread_state_t& state = states[thread_index];
+			state.row.assign(V, inf<scalar_t>);
+			const scalar_t source_potential = potentials[source].first;
+			auto visitor = [&state, &potentials, &source_potential](vertex_index_t index, scalar_t distance) -> bool {
+				state.row[index] = distance - source_potential + potentials[index].first;
+				return false;
+			};
+			detail::basic_dijkstra<binary_heap, detail::bind_dijkstra_queue_entry_t<>::templ>(graph, std::ranges::single_view(static_cast<vertex_index_t>(source)), visitor, state.workspace, reweighted);
+			row_callback(static_cast<vertex_index_t>(source), std::span<scalar_t const>(state.row));
+		});
+	}
+	// Writes the distances into matrix, row-major with V rows of V columns.
+	template<typename graph_t, typename weight_invokable_t, typename scalar_t>
+	void johnson_all_pairs(graph_t const& graph, std::span<scalar_t> matrix, weight_invokable_t weight_invokable, thread_pool& pool)
+	{
+		const std::size_t V = graph.V.size();
+		assert(matrix.size() == V * V);
+		johnson_all_pairs(graph, weight_invokable, pool, [matrix, V](auto source, auto const& row){
+			std::copy(row.begin(), row.end(), matrix.begin() + source * V);
+		});
+	}
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto johnson_all_pairs(graph_t const& graph, weight_invokable_t weight_invokable, thread_pool& pool)
+	{
+		using scalar_t = dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const typename graph_t::out_edge_t>>;
+		distance_matrix<scalar_t> result(graph.V.size(), graph.V.size());
+		johnson_all_pairs(graph, weight_invokable, pool, [&result](auto source, auto const& row){
+			std::copy(row.begin(), row.end(), result.row(source).begin());
+		});
+		return result;
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto johnson_all_pairs(graph_t const& graph, thread_pool& pool)
+	{
+		return johnson_all_pairs(graph, dijkstra_default_weight_invokable<graph_t>(), pool);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto johnson_all_pairs(graph_t const& graph)
+	{
+		thread_pool pool;
+		return johnson_all_pairs(graph, pool);
+	}
+}
+
+#endif // !QUIVER_APSP_JOHNSON_HPP_INCLUDED
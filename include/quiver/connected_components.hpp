@@ -17,11 +17,12 @@
 namespace quiver
 {
 	template<typename graph_t>
-	disjoint_set<> get_disjoint_set(graph_t const& graph)
+	disjoint_set<path_splitting, vertex_index_type<graph_t>> get_disjoint_set(graph_t const& graph)
 	{
 		static_assert(is_undirected_v<graph_t>, "connected components exist in undirected graphs");
+		using vertex_index_t = vertex_index_type<graph_t>;
 
-		disjoint_set<> cc(graph.V.size());
+		disjoint_set<path_splitting, vertex_index_t> cc(graph.V.size());
 		vertex_index_t vert_index = 0;
 		for(auto const& vert : graph.V) {
 			for(auto const& out_edge : vert.out_edges)
@@ -37,12 +38,14 @@ namespace quiver
 		typename edge_properties_t,
 		typename vertex_properties_t,
 		template<typename> class out_edge_container,
-		template<typename> class vertex_container
+		template<typename> class vertex_container,
+		typename index_t
 	>
-	std::vector<adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>>
-	split_ccs(adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> const& graph)
+	std::vector<adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>>
+	split_ccs(adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> const& graph)
 	{
-		using graph_t = adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>;
+		using graph_t = adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>;
+		using vertex_index_t = index_t;
 		auto ds = get_disjoint_set(graph);									// vertex [0..V] -> root [0..V]
 
 		std::unordered_map<std::size_t, std::size_t> compressed_cc_index;	// disjoint set roots -> cc index [0..|CC|]
@@ -0,0 +1,281 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_CSR_GRAPH_HPP_INCLUDED
+#define QUIVER_CSR_GRAPH_HPP_INCLUDED
+
+#include <quiver/adjacency_list.hpp>
+#include <quiver/typedefs.hpp>
+#include <quiver/util.hpp>
+#include <quiver/properties.hpp>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+#include <span>
+#include <cassert>
+
+namespace quiver
+{
+	namespace detail
+	{
+		// We need this base class because we need a standard layout type for offsetof.
+		// See adjacency_list_base.
+		template<typename edge_properties_t, typename vertex_properties_t, typename index_t, typename derived_t>
+		class csr_graph_base
+		{
+			using out_edge_t = out_edge<edge_properties_t, index_t>;
+			using vertex_t = ::quiver::vertex<vertex_properties_t, std::span<out_edge_t const>>;
+			using csr_graph = derived_t;
+			using vertex_span_type = vertex_span_t<csr_graph, csr_graph_base>;
+			friend vertex_span_type;
+			using edge_span_type = edge_span_t<csr_graph, csr_graph_base>;
+			friend edge_span_type;
+
+		protected:
+			// private:
+			std::vector<out_edge_t> m_out_edges; // the out-edges of all vertices, back to back
+			std::vector<vertex_t> m_vertices; // every vertex views its slice of m_out_edges
+
+			// public:
+			vertex_span_type V; // when renaming, the corresponding offsetof invocation must be changed too
+			edge_span_type E; // when renaming, the corresponding offsetof invocation must be changed too
+
+			csr_graph_base() noexcept
+			{
+			}
+
+			csr_graph_base(csr_graph_base const& rhs)
+			: m_out_edges(rhs.m_out_edges), m_vertices(rhs.m_vertices)
+			{
+				// the copied vertices still view rhs.m_out_edges
+				for(auto& vertex : m_vertices)
+					vertex.out_edges = { m_out_edges.data() + (vertex.out_edges.data() - rhs.m_out_edges.data()), vertex.out_edges.size() };
+			}
+			csr_graph_base(csr_graph_base&& rhs) noexcept
+			: m_out_edges(std::move(rhs.m_out_edges)), m_vertices(std::move(rhs.m_vertices))
+			{
+			}
+
+			csr_graph_base& operator=(csr_graph_base const& rhs)
+			{
+				return *this = csr_graph_base(rhs);
+			}
+			csr_graph_base& operator=(csr_graph_base&& rhs) noexcept
+			{
+				m_out_edges = std::move(rhs.m_out_edges);
+				m_vertices = std::move(rhs.m_vertices);
+				return *this;
+			}
+		};
+	}
+
+	// An immutable compressed sparse row representation of a graph.
+	// The out-edges of all vertices are stored contiguously in a single array and every
+	// vertex refers to its slice of it, so traversals touch one allocation instead of V.
+	// V[i].out_edges, V[i].properties(), E(from, to) and directivity behave like they do
+	// for adjacency_list, so the search, MST, SCC and toposort algorithms accept both.
+	template<
+		directivity_t dir = directed,
+		typename edge_properties_t = void,
+		typename vertex_properties_t = void,
+		typename index_t = vertex_index_t
+	>
+	class csr_graph : private detail::csr_graph_base<edge_properties_t, vertex_properties_t, index_t, csr_graph<dir, edge_properties_t, vertex_properties_t, index_t>>
+	{
+	public:
+		using vertex_index_t = index_t;
+
+	private:
+		using base_t = detail::csr_graph_base<edge_properties_t, vertex_properties_t, index_t, csr_graph>;
+
+	public:
+		using edge_t = edge<edge_properties_t, index_t>;
+		using out_edge_t = out_edge<edge_properties_t, index_t>;
+		using out_edge_list_t = std::span<out_edge_t const>;
+		using vertex_t = ::quiver::vertex<vertex_properties_t, out_edge_list_t>;
+
+		inline static constexpr directivity_t directivity = dir;
+
+		template<template<typename> class out_edge_container = vector, template<typename> class vertex_container = vector>
+		using adjacency_list_t = adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>;
+
+	private:
+		using base_t::m_out_edges;
+		using base_t::m_vertices;
+
+		// accessible through .V
+		constexpr std::size_t vertex_size() const noexcept		{ return m_vertices.size(); }
+		constexpr bool vertex_empty() const noexcept			{ return m_vertices.empty(); }
+
+		constexpr auto vertex_begin() noexcept					{ return m_vertices.begin(); }
+		constexpr auto vertex_begin() const noexcept			{ return m_vertices.begin(); }
+		constexpr auto vertex_cbegin() const noexcept			{ return m_vertices.cbegin(); }
+		constexpr auto vertex_end() noexcept					{ return m_vertices.end(); }
+		constexpr auto vertex_end() const noexcept				{ return m_vertices.end(); }
+		constexpr auto vertex_cend() const noexcept				{ return m_vertices.cend(); }
+
+		constexpr vertex_t const& vertex_get(vertex_index_t index) const noexcept
+		{
+			assert(index < m_vertices.size());
+			return m_vertices[index];
+		}
+		constexpr vertex_t& vertex_get(vertex_index_t index) noexcept
+		{
+			assert(index < m_vertices.size());
+			return m_vertices[index];
+		}
+
+		// accessible through .E
+		constexpr std::size_t edge_size() const noexcept
+		{
+			if constexpr(directivity == directed)
+				return m_out_edges.size();
+			else if constexpr(directivity == undirected)
+				return m_out_edges.size() / 2;
+		}
+		constexpr bool edge_empty() const noexcept
+		{
+			return m_out_edges.empty();
+		}
+		constexpr std::size_t edge_max_size() const noexcept
+		{
+			if constexpr(directivity == directed)
+				return vertex_size() * (vertex_size() - 1);
+			else if constexpr(directivity == undirected)
+				return vertex_size() * (vertex_size() - 1) / 2;
+		}
+
+		constexpr out_edge_t const* edge_get(vertex_index_t from, vertex_index_t to) const noexcept
+		{
+			assert(from < vertex_size());
+			assert(to < vertex_size());
+
+			for(out_edge_t const& out_edge : m_vertices[from].out_edges)
+				if(out_edge.to == to)
+					return &out_edge;
+			return nullptr;
+		}
+
+	public:
+		csr_graph() noexcept = default;
+
+		// time complexity:  O(E + V)
+		template<template<typename> class out_edge_container, template<typename> class vertex_container>
+		explicit csr_graph(adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> const& graph)
+		{
+			std::size_t out_edges = 0;
+			for(auto const& vertex : graph.V)
+				out_edges += vertex.out_degree();
+
+			// reserve up front, so that the vertices' views into m_out_edges stay valid
+			m_out_edges.reserve(out_edges);
+			m_vertices.reserve(graph.V.size());
+			for(auto const& vertex : graph.V) {
+				out_edge_t const* const first = m_out_edges.data() + m_out_edges.size();
+				m_out_edges.insert(m_out_edges.end(), vertex.out_edges.begin(), vertex.out_edges.end());
+				m_vertices.emplace_back(vertex.properties()).out_edges = { first, vertex.out_degree() };
+			}
+			assert(m_out_edges.size() == out_edges);
+		}
+
+		using vertex_span_type = detail::vertex_span_t<csr_graph, base_t>;
+		friend vertex_span_type;
+		using base_t::V;
+		static_assert(std::is_same_v<decltype(V), vertex_span_type>);
+
+		using edge_span_type = detail::edge_span_t<csr_graph, base_t>;
+		friend edge_span_type;
+		using base_t::E;
+		static_assert(std::is_same_v<decltype(E), edge_span_type>);
+
+		std::size_t in_degree(vertex_index_t index) const noexcept
+		{
+			if constexpr(directivity == directed) {
+				std::size_t count = 0;
+				for(auto const& vertex : m_vertices)
+					count += vertex.has_edge_to(index);
+				return count;
+			} else if constexpr(directivity == undirected) {
+				return out_degree(index);
+			}
+		}
+		std::size_t out_degree(vertex_index_t index) const noexcept
+		{
+			return V[index].out_degree();
+		}
+		std::size_t degree(vertex_index_t index) const noexcept
+		{
+			static_assert(directivity == undirected, "degree only defined for undirected graphs");
+			return out_degree(index);
+		}
+
+		// Since a csr_graph cannot grow edges, this returns a mutable adjacency_list.
+		template<template<typename> class out_edge_container = vector, template<typename> class vertex_container = vector>
+		adjacency_list_t<out_edge_container, vertex_container> strip_edges() const
+		{
+			adjacency_list_t<out_edge_container, vertex_container> result;
+			result.V.reserve(V.size());
+			for(auto const& vertex : m_vertices)
+				result.V.emplace(vertex.properties());
+			return result;
+		}
+
+		// time complexity:  O(E + V)
+		template<template<typename> class out_edge_container = vector, template<typename> class vertex_container = vector>
+		adjacency_list_t<out_edge_container, vertex_container> thaw() const
+		{
+			using result_t = adjacency_list_t<out_edge_container, vertex_container>;
+			result_t result;
+			result.V.reserve(V.size());
+			for(auto const& vertex : m_vertices) {
+				typename result_t::vertex_t thawed(vertex.properties());
+				if constexpr(requires { thawed.out_edges.reserve(vertex.out_degree()); })
+					thawed.out_edges.reserve(vertex.out_degree());
+				thawed.out_edges.insert(thawed.out_edges.end(), vertex.out_edges.begin(), vertex.out_edges.end());
+				result.V.emplace(std::move(thawed));
+			}
+			return result;
+		}
+
+		void swap(csr_graph& rhs) noexcept
+		{
+			using std::swap;
+			swap(m_out_edges, rhs.m_out_edges);
+			swap(m_vertices, rhs.m_vertices);
+		}
+
+		static constexpr bool is_weighted() noexcept
+		{
+			return is_weighted_v<csr_graph>;
+		}
+		static constexpr bool is_simple() noexcept
+		{
+			return !is_weighted() && directivity == undirected;
+		}
+	};
+
+	template<directivity_t dir, typename edge_properties_t, typename vertex_properties_t, typename index_t>
+	void swap(csr_graph<dir, edge_properties_t, vertex_properties_t, index_t>& lhs, csr_graph<dir, edge_properties_t, vertex_properties_t, index_t>& rhs) noexcept
+	{
+		lhs.swap(rhs);
+	}
+
+	template<directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+	csr_graph<dir, edge_properties_t, vertex_properties_t, index_t> freeze(adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> const& graph)
+	{
+		return csr_graph<dir, edge_properties_t, vertex_properties_t, index_t>(graph);
+	}
+	template<template<typename> class out_edge_container = vector, template<typename> class vertex_container = vector, directivity_t dir, typename edge_properties_t, typename vertex_properties_t, typename index_t>
+	adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> thaw(csr_graph<dir, edge_properties_t, vertex_properties_t, index_t> const& graph)
+	{
+		return graph.template thaw<out_edge_container, vertex_container>();
+	}
+}
+
+#endif // !QUIVER_CSR_GRAPH_HPP_INCLUDED
@@ -11,6 +11,10 @@
 // #include <quiver/adjacency_list.hpp>
 #include <vector>
 #include <numeric>
+#include <atomic>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
 #include <cassert>
 
 namespace quiver
@@ -23,93 +27,96 @@ namespace quiver
 		path_splitting		// O(a(n)) time
 	};
 
-	template<typename derived_t, disjoint_set_find_strategy_t>
+	template<typename derived_t, disjoint_set_find_strategy_t, typename index_t>
 	class disjoint_set_find_injector;
-	template<typename derived_t>
-	class disjoint_set_find_injector<derived_t, naive>
+	template<typename derived_t, typename index_t>
+	class disjoint_set_find_injector<derived_t, naive, index_t>
 	{
 		auto&& derived() const noexcept	{ return static_cast<derived_t const&>(*this); }
 		auto&& derived()       noexcept	{ return static_cast<derived_t      &>(*this); }
 
 	public:
-		std::size_t find(std::size_t index) const noexcept
+		index_t find(index_t index) const noexcept
 		{
-			std::size_t next;
+			index_t next;
 			while(index != (next = derived().m_parent[index]))
 				index = next;
 			return index;
 		}
 	};
-	template<typename derived_t>
-	class disjoint_set_find_injector<derived_t, path_compression>
+	template<typename derived_t, typename index_t>
+	class disjoint_set_find_injector<derived_t, path_compression, index_t>
 	{
 		auto&& derived() const noexcept	{ return static_cast<derived_t const&>(*this); }
 		auto&& derived()       noexcept	{ return static_cast<derived_t      &>(*this); }
 
 	public:
-		std::size_t find(std::size_t index) noexcept
+		index_t find(index_t index) noexcept
 		{
-			const std::size_t start = index;
-			for(std::size_t next; index != (next = derived().m_parent[index]); index = next);
-			const std::size_t root = index;
+			const index_t start = index;
+			for(index_t next; index != (next = derived().m_parent[index]); index = next);
+			const index_t root = index;
 			index = start;
-			for(std::size_t next; index != (next = derived().m_parent[index]); index = next)
+			for(index_t next; index != (next = derived().m_parent[index]); index = next)
 				derived().m_parent[index] = root;
 			return root;
 		}
 	};
-	template<typename derived_t>
-	class disjoint_set_find_injector<derived_t, path_halving>
+	template<typename derived_t, typename index_t>
+	class disjoint_set_find_injector<derived_t, path_halving, index_t>
 	{
 		auto&& derived() const noexcept	{ return static_cast<derived_t const&>(*this); }
 		auto&& derived()       noexcept	{ return static_cast<derived_t      &>(*this); }
 
 	public:
-		std::size_t find(std::size_t index) noexcept
+		index_t find(index_t index) noexcept
 		{
 			while(index != derived().m_parent[index])
 				index = derived().m_parent[index] = derived().m_parent[derived().m_parent[index]];
 			return index;
 		}
 	};
-	template<typename derived_t>
-	class disjoint_set_find_injector<derived_t, path_splitting>
+	template<typename derived_t, typename index_t>
+	class disjoint_set_find_injector<derived_t, path_splitting, index_t>
 	{
 		auto&& derived() const noexcept	{ return static_cast<derived_t const&>(*this); }
 		auto&& derived()       noexcept	{ return static_cast<derived_t      &>(*this); }
 
 	public:
-		std::size_t find(std::size_t index) noexcept
+		index_t find(index_t index) noexcept
 		{
-			for(std::size_t next; index != (next = derived().m_parent[index]); index = next)
+			for(index_t next; index != (next = derived().m_parent[index]); index = next)
 				derived().m_parent[index] = derived().m_parent[next];
 			return index;
 		}
 	};
 
+	// index_t is the type of the stored parents and cardinalities, it must be able to represent size().
 	template<
-		disjoint_set_find_strategy_t find_strategy_ = path_splitting
+		disjoint_set_find_strategy_t find_strategy_ = path_splitting,
+		typename index_t = std::size_t
 	>
-	class disjoint_set : public disjoint_set_find_injector<disjoint_set<find_strategy_>, find_strategy_>
+	class disjoint_set : public disjoint_set_find_injector<disjoint_set<find_strategy_, index_t>, find_strategy_, index_t>
 	{
-		using base_t = disjoint_set_find_injector<disjoint_set<find_strategy_>, find_strategy_>;
+		using base_t = disjoint_set_find_injector<disjoint_set<find_strategy_, index_t>, find_strategy_, index_t>;
 		friend base_t;
 
-		std::vector<std::size_t> m_parent;
-		std::vector<std::size_t> m_card;
+		std::vector<index_t> m_parent;
+		std::vector<index_t> m_card;
 		std::size_t m_sets = 0;
 
-		bool check_size_invariant(std::size_t index)
+		bool check_size_invariant(index_t index)
 		{
 			const std::size_t card = cardinality(index);
 			std::size_t N = 0;
 			for(std::size_t i = 0; i < size(); ++i)
-				N += same_set(i, index);
+				N += same_set(static_cast<index_t>(i), index);
 			return card == N;
 		}
 
 	public:
 		static constexpr disjoint_set_find_strategy_t find_strategy = find_strategy_;
+		using index_type = index_t;
 
 		disjoint_set() noexcept = default;
 		explicit disjoint_set(std::size_t size)
@@ -121,7 +128,7 @@ namespace quiver
 		{
 			m_card.resize(size, 1);
 			m_parent.resize(size);
-			std::iota(m_parent.begin(), m_parent.end(), std::size_t{});
+			std::iota(m_parent.begin(), m_parent.end(), index_t{});
 			m_sets = size;
 		}
 
@@ -135,22 +142,22 @@ namespace quiver
 			return m_sets;
 		}
 
-		// std::size_t find(std::size_t index) /* const */ noexcept;
+		// index_t find(index_t index) /* const */ noexcept;
 		using base_t::find;
 
-		bool unite(std::size_t a, std::size_t b) noexcept
+		bool unite(index_t a, index_t b) noexcept
 		{
 			// find a's and b's roots
-			const std::size_t a_root = find(a);
-			const std::size_t b_root = find(b);
+			const index_t a_root = find(a);
+			const index_t b_root = find(b);
 
 			// a and b already belong to the same set
 			if(a_root == b_root)
 				return false;
 
 			// sort a and b by the cardinality of their respective sets
-			const std::size_t min_root = m_card[a_root] < m_card[b_root] ? a_root : b_root;
-			const std::size_t max_root = m_card[a_root] < m_card[b_root] ? b_root : a_root;
+			const index_t min_root = m_card[a_root] < m_card[b_root] ? a_root : b_root;
+			const index_t max_root = m_card[a_root] < m_card[b_root] ? b_root : a_root;
 
 			// attach the small tree to the large tree
 			m_parent[min_root] = max_root;
@@ -166,16 +173,108 @@ namespace quiver
 			return true;
 		}
 
-		std::size_t cardinality(std::size_t index) /* const */ noexcept
+		std::size_t cardinality(index_t index) /* const */ noexcept
 		{
 			return m_card[find(index)];
 		}
 
-		bool same_set(std::size_t a, std::size_t b) /* const */ noexcept
+		bool same_set(index_t a, index_t b) /* const */ noexcept
 		{
 			return a == b || find(a) == find(b);
 		}
 	};
+
+	// A disjoint_set that many threads may unite and query at the same time, without locks.
+	// Roots are linked by a fixed pseudo-random priority through a CAS on the parent of the lower one,
+	// which keeps the trees shallow in expectation without cardinalities, and find halves the paths it walks with CAS,
+	// whose failure is harmless because parents only ever move closer to the root.
+	// While unite runs elsewhere, find returns what was the root at some point during the call,
+	// and same_set only answers false when one of the roots was still a root after both were found.
+	template<typename index_t = std::size_t>
+	class concurrent_disjoint_set
+	{
+		std::vector<std::atomic<index_t>> m_parent;
+		std::atomic<std::size_t> m_sets = 0;
+
+		// a bijection, so no two roots tie
+		static constexpr std::uint64_t priority(index_t index) noexcept
+		{
+			std::uint64_t x = static_cast<std::uint64_t>(index);
+			x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+			x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+			return x ^ (x >> 31);
+		}
+
+	public:
+		using index_type = index_t;
+
+		concurrent_disjoint_set() noexcept = default;
+		explicit concurrent_disjoint_set(std::size_t size)
+		{
+			reset(size);
+		}
+
+		// not thread safe
+		void reset(std::size_t size)
+		{
+			std::vector<std::atomic<index_t>>(size).swap(m_parent);
+			for(std::size_t i = 0; i < size; ++i)
+				m_parent[i].store(static_cast<index_t>(i), std::memory_order_relaxed);
+			m_sets.store(size, std::memory_order_relaxed);
+		}
+
+		std::size_t size() const noexcept
+		{
+			return m_parent.size();
+		}
+		std::size_t sets() const noexcept
+		{
+			return m_sets.load(std::memory_order_relaxed);
+		}
+
+		index_t find(index_t index) noexcept
+		{
+			assert(index < size());
+			for(index_t parent; index != (parent = m_parent[index].load(std::memory_order_acquire));) {
+				const index_t grandparent = m_parent[parent].load(std::memory_order_acquire);
+				if(parent != grandparent)
+					m_parent[index].compare_exchange_weak(parent, grandparent, std::memory_order_relaxed);
+				index = grandparent;
+			}
+			return index;
+		}
+
+		bool unite(index_t a, index_t b) noexcept
+		{
+			for(;;) {
+				a = find(a);
+				b = find(b);
+				if(a == b)
+					return false;
+				// attach the root of lower priority, unless another thread has linked it meanwhile
+				if(priority(b) < priority(a))
+					std::swap(a, b);
+				index_t expected = a;
+				if(m_parent[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel)) {
+					m_sets.fetch_sub(1, std::memory_order_relaxed);
+					return true;
+				}
+			}
+		}
+
+		bool same_set(index_t a, index_t b) noexcept
+		{
+			for(;;) {
+				a = find(a);
+				b = find(b);
+				if(a == b)
+					return true;
+				// a was a root after b was found, so they were apart at that moment
+				if(m_parent[a].load(std::memory_order_acquire) == a)
+					return false;
+			}
+		}
+	};
 }
 
 #endif // !QUIVER_DISJOINT_SET_HPP_INCLUDED
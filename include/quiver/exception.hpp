@@ -8,7 +8,10 @@
 #ifndef QUIVER_EXCEPTION_HPP_INCLUDED
 #define QUIVER_EXCEPTION_HPP_INCLUDED
 
+#include <quiver/typedefs.hpp>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace quiver
 {
@@ -16,6 +19,20 @@ namespace quiver
 	{
 		using std::invalid_argument::invalid_argument;
 	};
+	// Thrown by the shortest path searches for negative weights; cycle lists the vertices of a negative cycle in edge order.
+	struct negative_cycle : public std::invalid_argument
+	{
+		std::vector<vertex_index_t> cycle;
+
+		negative_cycle(char const* what, std::vector<vertex_index_t> cycle)
+		: std::invalid_argument(what), cycle(std::move(cycle))
+		{
+		}
+	};
+	struct invalid_format : public std::runtime_error
+	{
+		using std::runtime_error::runtime_error;
+	};
 }
 
 #endif // !QUIVER_EXCEPTION_HPP_INCLUDED
@@ -9,5 +9,9 @@
 #define QUIVER_HEAPS_HPP_INCLUDED
 
 #include <quiver/heaps/binary_heap.hpp>
+#include <quiver/heaps/bucket_queue.hpp>
+#include <quiver/heaps/d_ary_heap.hpp>
+#include <quiver/heaps/indexed_heap.hpp>
+#include <quiver/heaps/radix_heap.hpp>
 
 #endif // !QUIVER_HEAPS_HPP_INCLUDED
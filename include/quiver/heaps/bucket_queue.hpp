@@ -0,0 +1,140 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_HEAPS_BUCKET_QUEUE_HPP_INCLUDED
+#define QUIVER_HEAPS_BUCKET_QUEUE_HPP_INCLUDED
+
+#include <quiver/heaps/radix_heap.hpp>
+#include <vector>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <cassert>
+
+namespace quiver
+{
+	// A monotone min-queue for integer keys with a bounded spread, a.k.a. Dial's circular bucket queue.
+	// Every key pushed must lie in [last_key(), last_key() + span), where last_key() is the key of the
+	// smallest value in the queue or, if it is empty, of the last extracted one.
+	// There is one bucket per key in that window, so push is O(1) and top skips at most span empty buckets.
+	// Keys are obtained through radix_heap_key, like for radix_heap. Since top advances the window, it is not const.
+	// The span is fixed at construction, e.g. to the largest edge weight + 1 for Dial's algorithm.
+	template<typename T, typename key_t = radix_heap_key<T>>
+	class bucket_queue
+	{
+	public:
+		using value_type = T;
+		using key_type = std::make_unsigned_t<std::remove_cvref_t<decltype(key_t::get(std::declval<T const&>()))>>;
+
+	private:
+		std::vector<std::vector<value_type>> m_buckets;
+		std::size_t m_span;
+		key_type m_last = 0;
+		std::size_t m_size = 0;
+
+		static key_type key(value_type const& value) noexcept
+		{
+			const auto key = key_t::get(value);
+			if constexpr(std::is_signed_v<decltype(key)>)
+				assert(key >= 0);
+			return static_cast<key_type>(key);
+		}
+		std::vector<value_type>& current() noexcept
+		{
+			return m_buckets[m_last % m_span];
+		}
+		// Advances the window to the smallest key.
+		void settle() noexcept
+		{
+			assert(!empty());
+			while(current().empty())
+				++m_last;
+		}
+
+	public:
+		explicit bucket_queue(std::size_t span)
+		: m_buckets(span)
+		, m_span(span)
+		{
+			assert(span > 0);
+		}
+
+		std::size_t size() const noexcept
+		{
+			return m_size;
+		}
+		bool empty() const noexcept
+		{
+			return size() == 0;
+		}
+		std::size_t span() const noexcept
+		{
+			return m_span;
+		}
+		// Also forgets the last extracted key. O(1) if the queue is empty, O(span) otherwise.
+		void clear()
+		{
+			if(!empty())
+				for(auto& bucket : m_buckets)
+					bucket.clear();
+			m_last = 0;
+			m_size = 0;
+		}
+
+		key_type last_key() const noexcept
+		{
+			return m_last;
+		}
+
+		value_type const& top()
+		{
+			settle();
+			return current().back();
+		}
+		template<typename... args_t>
+		void push(args_t&&... args)
+		{
+			value_type value(std::forward<args_t>(args)...);
+			const key_type value_key = key(value);
+			assert(value_key >= m_last);
+			assert(value_key - m_last < m_span);
+			m_buckets[value_key % m_span].push_back(std::move(value));
+			++m_size;
+		}
+		void pop()
+		{
+			settle();
+			current().pop_back();
+			--m_size;
+		}
+		value_type extract_top()
+		{
+			settle();
+			value_type result(std::move(current().back()));
+			current().pop_back();
+			--m_size;
+			return result;
+		}
+
+		void swap(bucket_queue& rhs) noexcept
+		{
+			using std::swap;
+			swap(m_buckets, rhs.m_buckets);
+			swap(m_span, rhs.m_span);
+			swap(m_last, rhs.m_last);
+			swap(m_size, rhs.m_size);
+		}
+	};
+
+	template<typename T, typename key_t>
+	void swap(bucket_queue<T, key_t>& lhs, bucket_queue<T, key_t>& rhs) noexcept
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif // !QUIVER_HEAPS_BUCKET_QUEUE_HPP_INCLUDED
@@ -0,0 +1,214 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_HEAPS_INDEXED_HEAP_HPP_INCLUDED
+#define QUIVER_HEAPS_INDEXED_HEAP_HPP_INCLUDED
+
+#include <functional>
+#include <vector>
+#include <cassert>
+#include <utility>
+#include <type_traits>
+#include <cstddef>
+
+namespace quiver
+{
+	// A binary heap of (key, index) pairs that holds every index in [0, n) at most once.
+	// A position map from index to slot makes contains, key, decrease and erase by index possible,
+	// which is what the "decrease key" variant of Dijkstra needs. Its size is bounded by n.
+	template<typename key_t, typename index_t = std::size_t, typename comparator_t = std::less<>>
+	class indexed_heap
+	{
+		static_assert(std::is_unsigned_v<index_t>, "index_t must be an unsigned integer type");
+
+	public:
+		using key_type = key_t;
+		using index_type = index_t;
+		using comparator_type = comparator_t;
+		using value_type = std::pair<key_type, index_type>;
+
+	private:
+		static constexpr index_type npos = ~index_type{};
+
+		std::vector<value_type> m_container;
+		std::vector<index_type> m_positions; // npos for indices not in the heap
+		comparator_type m_comparator;
+
+		static constexpr std::size_t up(std::size_t slot) noexcept		{ return (slot - 1) / 2; }
+		static constexpr std::size_t down(std::size_t slot) noexcept	{ return 2 * slot + 1; }
+
+		void place(std::size_t slot, value_type&& value) noexcept
+		{
+			m_positions[value.second] = static_cast<index_type>(slot);
+			m_container[slot] = std::move(value);
+		}
+		// Both sifts move a hole instead of swapping, writing every moved entry and its position once.
+		void sift_up(std::size_t slot)
+		{
+			value_type value(std::move(m_container[slot]));
+			while(slot != 0) {
+				const std::size_t parent = up(slot);
+				if(!m_comparator(value.first, m_container[parent].first))
+					break;
+				place(slot, std::move(m_container[parent]));
+				slot = parent;
+			}
+			place(slot, std::move(value));
+		}
+		void sift_down(std::size_t slot)
+		{
+			value_type value(std::move(m_container[slot]));
+			for(const std::size_t size = m_container.size();;) {
+				std::size_t child = down(slot);
+				if(child >= size)
+					break;
+				if(child + 1 < size && m_comparator(m_container[child + 1].first, m_container[child].first))
+					++child;
+				if(!m_comparator(m_container[child].first, value.first))
+					break;
+				place(slot, std::move(m_container[child]));
+				slot = child;
+			}
+			place(slot, std::move(value));
+		}
+
+	public:
+		indexed_heap()
+		{
+		}
+		explicit indexed_heap(std::size_t n, comparator_t comparator = {})
+		: m_positions(n, npos), m_comparator(std::move(comparator))
+		{
+		}
+
+		// Empties the heap and makes room for the indices [0, n).
+		void reset(std::size_t n)
+		{
+			clear();
+			if(n > m_positions.size())
+				m_positions.resize(n, npos);
+		}
+		// O(size()), not O(n)
+		void clear() noexcept
+		{
+			for(value_type const& value : m_container)
+				m_positions[value.second] = npos;
+			m_container.clear();
+		}
+
+		std::size_t size() const noexcept
+		{
+			return m_container.size();
+		}
+		bool empty() const noexcept
+		{
+			return size() == 0;
+		}
+		// The exclusive upper bound of the indices.
+		std::size_t capacity() const noexcept
+		{
+			return m_positions.size();
+		}
+
+		bool contains(index_type index) const noexcept
+		{
+			assert(index < m_positions.size());
+			return m_positions[index] != npos;
+		}
+		key_type const& key(index_type index) const noexcept
+		{
+			assert(contains(index));
+			return m_container[m_positions[index]].first;
+		}
+
+		// a.k.a. 'find_min'
+		value_type const& top() const noexcept
+		{
+			assert(!empty());
+			return m_container.front();
+		}
+		// a.k.a. 'insert'; index must not be in the heap
+		void push(index_type index, key_type key)
+		{
+			assert(!contains(index));
+			m_container.emplace_back(std::move(key), index);
+			sift_up(m_container.size() - 1);
+		}
+		// a.k.a. 'decrease_key'; key must not be greater than the current key of index
+		void decrease(index_type index, key_type key)
+		{
+			assert(contains(index));
+			const std::size_t slot = m_positions[index];
+			assert(!m_comparator(m_container[slot].first, key));
+			m_container[slot].first = std::move(key);
+			sift_up(slot);
+		}
+		// Inserts index or lowers its key. Returns false, and does nothing, iff index already has a key that is not greater.
+		bool push_or_decrease(index_type index, key_type key)
+		{
+			if(!contains(index)) {
+				push(index, std::move(key));
+				return true;
+			}
+			if(!m_comparator(key, this->key(index)))
+				return false;
+			decrease(index, std::move(key));
+			return true;
+		}
+		void erase(index_type index)
+		{
+			assert(contains(index));
+			const std::size_t slot = m_positions[index];
+			m_positions[index] = npos;
+			value_type replacement(std::move(m_container.back()));
+			m_container.pop_back();
+			if(slot == m_container.size())
+				return;
+			const bool cmp = m_comparator(m_container[slot].first, replacement.first);
+			place(slot, std::move(replacement));
+			if(cmp)
+				sift_down(slot);
+			else
+				sift_up(slot);
+		}
+		// a.k.a. 'remove_min'
+		void pop()
+		{
+			assert(!empty());
+			erase(top().second);
+		}
+		// a.k.a. 'extract_min'
+		value_type extract_top()
+		{
+			assert(!empty());
+			value_type result = top();
+			pop();
+			return result;
+		}
+
+		comparator_type const& comparator() const noexcept
+		{
+			return m_comparator;
+		}
+
+		void swap(indexed_heap& rhs) noexcept
+		{
+			using std::swap;
+			swap(m_container, rhs.m_container);
+			swap(m_positions, rhs.m_positions);
+			swap(m_comparator, rhs.m_comparator);
+		}
+	};
+
+	template<typename key_t, typename index_t, typename comparator_t>
+	void swap(indexed_heap<key_t, index_t, comparator_t>& lhs, indexed_heap<key_t, index_t, comparator_t>& rhs) noexcept
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif // !QUIVER_HEAPS_INDEXED_HEAP_HPP_INCLUDED
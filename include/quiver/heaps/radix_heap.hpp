@@ -0,0 +1,160 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_HEAPS_RADIX_HEAP_HPP_INCLUDED
+#define QUIVER_HEAPS_RADIX_HEAP_HPP_INCLUDED
+
+#include <vector>
+#include <array>
+#include <limits>
+#include <type_traits>
+#include <algorithm>
+#include <utility>
+#include <bit>
+#include <cstddef>
+#include <cassert>
+
+namespace quiver
+{
+	// Maps a value to its non-negative integral key in a radix_heap or a bucket_queue.
+	// Specialize this for types that are not integers themselves.
+	template<typename T>
+	struct radix_heap_key
+	{
+		static_assert(std::is_integral_v<T>, "specialize radix_heap_key for non-integral types");
+
+		static constexpr T get(T const& value) noexcept
+		{
+			return value;
+		}
+	};
+
+	// A monotone min-heap for integer keys: no key pushed may be smaller than the last key extracted.
+	// Values are kept in buckets by the highest bit in which their key differs from the last extracted key,
+	// so every value moves down at most once per bit and both push and pop take amortized O(log C) time.
+	// Since top has to refill the lowest bucket, it is not const.
+	template<typename T, typename key_t = radix_heap_key<T>>
+	class radix_heap
+	{
+	public:
+		using value_type = T;
+		using key_type = std::make_unsigned_t<std::remove_cvref_t<decltype(key_t::get(std::declval<T const&>()))>>;
+
+	private:
+		static constexpr std::size_t bucket_count = std::numeric_limits<key_type>::digits + 1;
+
+		std::array<std::vector<value_type>, bucket_count> m_buckets;
+		key_type m_last = 0;
+		std::size_t m_size = 0;
+
+		static key_type key(value_type const& value) noexcept
+		{
+			const auto key = key_t::get(value);
+			if constexpr(std::is_signed_v<decltype(key)>)
+				assert(key >= 0);
+			return static_cast<key_type>(key);
+		}
+		std::size_t bucket(key_type key) const noexcept
+		{
+			return static_cast<std::size_t>(std::bit_width(static_cast<key_type>(key ^ m_last)));
+		}
+
+		// Makes sure that the values with the smallest key are in bucket 0.
+		void settle()
+		{
+			assert(!empty());
+			if(!m_buckets[0].empty())
+				return;
+			std::size_t i = 1;
+			while(m_buckets[i].empty())
+				++i;
+			std::vector<value_type>& source = m_buckets[i];
+			m_last = key(*std::min_element(source.begin(), source.end(), [](value_type const& lhs, value_type const& rhs){
+				return key(lhs) < key(rhs);
+			}));
+			for(value_type& value : source) {
+				const std::size_t target = bucket(key(value));
+				assert(target < i);
+				m_buckets[target].push_back(std::move(value));
+			}
+			source.clear();
+		}
+
+	public:
+		radix_heap()
+		{
+		}
+
+		std::size_t size() const noexcept
+		{
+			return m_size;
+		}
+		bool empty() const noexcept
+		{
+			return size() == 0;
+		}
+		// Also forgets the last extracted key.
+		void clear()
+		{
+			for(auto& bucket : m_buckets)
+				bucket.clear();
+			m_last = 0;
+			m_size = 0;
+		}
+
+		// The key of the last extracted value. Pushed keys must not be smaller.
+		key_type last_key() const noexcept
+		{
+			return m_last;
+		}
+
+		value_type const& top()
+		{
+			settle();
+			return m_buckets[0].back();
+		}
+		template<typename... args_t>
+		void push(args_t&&... args)
+		{
+			value_type value(std::forward<args_t>(args)...);
+			const key_type value_key = key(value);
+			assert(value_key >= m_last);
+			m_buckets[bucket(value_key)].push_back(std::move(value));
+			++m_size;
+		}
+		void pop()
+		{
+			settle();
+			m_buckets[0].pop_back();
+			--m_size;
+		}
+		value_type extract_top()
+		{
+			settle();
+			value_type result(std::move(m_buckets[0].back()));
+			m_buckets[0].pop_back();
+			--m_size;
+			return result;
+		}
+
+		void swap(radix_heap& rhs) noexcept
+		{
+			using std::swap;
+			swap(m_buckets, rhs.m_buckets);
+			swap(m_last, rhs.m_last);
+			swap(m_size, rhs.m_size);
+		}
+	};
+
+	template<typename T, typename key_t>
+	void swap(radix_heap<T, key_t>& lhs, radix_heap<T, key_t>& rhs) noexcept
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif // !QUIVER_HEAPS_RADIX_HEAP_HPP_INCLUDED
@@ -13,15 +13,22 @@
 #include <vector>
 #include <algorithm>
 #include <type_traits>
+#include <utility>
 
 namespace quiver
 {
+	// The result has the same type as graph.strip_edges(), which is graph_t itself for adjacency_list.
 	template<typename graph_t>
-	std::enable_if_t<is_weighted_v<graph_t>, graph_t> kruskal(graph_t const& graph)
+	using mst_t = std::decay_t<decltype(std::declval<graph_t const&>().strip_edges())>;
+
+	template<typename graph_t>
+	std::enable_if_t<is_weighted_v<graph_t>, mst_t<graph_t>> kruskal(graph_t const& graph)
 	{
 		static_assert(is_undirected_v<graph_t>, "kruskal operates on undirected graphs");
 
-		disjoint_set<> cc(graph.V.size());
+		using vertex_index_t = vertex_index_type<graph_t>;
+
+		disjoint_set<path_splitting, vertex_index_t> cc(graph.V.size());
 		struct edge_t
 		{
 			vertex_index_t from, to;
@@ -46,7 +53,7 @@ namespace quiver
 		}
 		std::sort(edges.begin(), edges.end(), [](edge_t const& lhs, edge_t const& rhs){ return lhs.ptr->weight < rhs.ptr->weight; });
 
-		graph_t mst = graph.strip_edges();
+		mst_t<graph_t> mst = graph.strip_edges();
 		for(edge_t const& e : edges)
 		{
 			if(cc.unite(e.from, e.to))
@@ -55,12 +62,14 @@ namespace quiver
 		return mst;
 	}
 	template<typename graph_t>
-	std::enable_if_t<!is_weighted_v<graph_t>, graph_t> kruskal(graph_t const& graph)
+	std::enable_if_t<!is_weighted_v<graph_t>, mst_t<graph_t>> kruskal(graph_t const& graph)
 	{
 		static_assert(is_undirected_v<graph_t>, "kruskal operates on undirected graphs");
 
-		graph_t mst = graph.strip_edges();
-		disjoint_set<> cc(graph.V.size());
+		using vertex_index_t = vertex_index_type<graph_t>;
+
+		mst_t<graph_t> mst = graph.strip_edges();
+		disjoint_set<path_splitting, vertex_index_t> cc(graph.V.size());
 		vertex_index_t vert_index = 0;
 		for(auto const& vert : graph.V) {
 			for(auto const& out_edge : vert.out_edges)
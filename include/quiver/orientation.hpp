@@ -18,12 +18,13 @@ namespace quiver
 
 	// orientation is a function bool(vertex_index_t from, vertex_index_t to) that returns true iff (from,to) should be element of E.
 	// The existence of (from,to) implies the nonexistence of (to,from) in E.
-	template<typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename orientation_t>
-	adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>
-	orient(adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> const& graph, orientation_t orientation)
+	template<typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, typename orientation_t>
+	adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>
+	orient(adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> const& graph, orientation_t orientation)
 	{
+		using vertex_index_t = index_t;
 		const std::size_t V = graph.V.size();
-		adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> result;
+		adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> result;
 		result.V.reserve(V);
 		for(auto const& vertex : graph)
 			result.V.emplace(vertex.properties());
@@ -39,12 +40,13 @@ namespace quiver
 		}
 		return result;
 	}
-	template<typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-	adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>
-	disorient(adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> const& graph)
+	template<typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t>
+	adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>
+	disorient(adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> const& graph)
 	{
+		using vertex_index_t = index_t;
 		const std::size_t V = graph.V.size();
-		adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> result;
+		adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> result;
 		result.reserve(V);
 		std::vector<bool> exists(V * V, false); // TODO: only needs to be a strict triangular matrix; saves more than half the memory
 		for(auto const& vertex : graph)
@@ -0,0 +1,285 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_ASTAR_HPP_INCLUDED
+#define QUIVER_SEARCH_ASTAR_HPP_INCLUDED
+
+#include <quiver/search/dijkstra.hpp>
+#include <quiver/search/visitation_table.hpp>
+#include <quiver/search/search_workspace.hpp>
+#include <quiver/adjacency_list.hpp>
+#include <quiver/heaps.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <concepts>
+#include <algorithm>
+#include <utility>
+#include <cassert>
+#include <ranges>
+#include <vector>
+
+namespace quiver
+{
+	namespace detail
+	{
+		// A Dijkstra queue entry that is ordered by distance + heuristic instead of distance.
+		template<typename dijkstra_queue_entry_t>
+		struct astar_queue_entry_t : public dijkstra_queue_entry_t
+		{
+			using scalar_t = decltype(dijkstra_queue_entry_t::distance);
+			scalar_t estimate;
+
+			template<typename... args_t>
+			[[nodiscard]] constexpr astar_queue_entry_t(scalar_t const& heuristic, args_t&&... args)
+			: dijkstra_queue_entry_t(std::forward<args_t>(args)...), estimate(this->distance + heuristic)
+			{
+			}
+		};
+		template<typename dijkstra_queue_entry_t>
+		[[nodiscard]] constexpr bool operator<(astar_queue_entry_t<dijkstra_queue_entry_t> const& lhs, astar_queue_entry_t<dijkstra_queue_entry_t> const& rhs)
+		{
+			return lhs.estimate < rhs.estimate;
+		}
+
+		template<template<typename, typename> typename basic_queue_entry_t, typename graph_t, typename weight_invokable_t>
+		using astar_queue_entry_type = astar_queue_entry_t<dijkstra_queue_entry_type<basic_queue_entry_t, graph_t, weight_invokable_t>>;
+
+		// heap_t is subject to the same requirements as for basic_dijkstra, ordered by estimate.
+		template<template<typename> typename heap_t, template<typename, typename> typename basic_queue_entry_t, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t, typename heuristic_t>
+		bool basic_astar(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable, heuristic_t heuristic, heap_t<astar_queue_entry_type<basic_queue_entry_t, graph_t, weight_invokable_t>>& queue)
+		{
+			using out_edge_t = typename graph_t::out_edge_t;
+			using scalar_t = std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>;
+			using queue_entry_t = astar_queue_entry_type<basic_queue_entry_t, graph_t, weight_invokable_t>;
+
+			queue.clear();
+			for(vertex_index_t index : start) {
+				assert(index < graph.V.size());
+				queue.push(static_cast<scalar_t>(heuristic(std::as_const(index))), index);
+			}
+
+			while(!queue.empty()) {
+				queue_entry_t const& top = queue.top();
+				if(has_been_visited(std::as_const(top.index))) {
+					queue.pop();
+					continue;
+				}
+				if(top.apply_to(visitor))
+					return true;
+
+				queue_entry_t extracted = queue.extract_top();
+				for(out_edge_t const& edge : graph.V[extracted.index].out_edges)
+					if(!has_been_visited(edge.to)) {
+						scalar_t&& edge_weight = weight_invokable(std::as_const(extracted.index), edge);
+						assert(std::as_const(extracted.distance) + std::as_const(edge_weight) >= std::as_const(extracted.distance));
+						queue.push(static_cast<scalar_t>(heuristic(std::as_const(edge.to))), edge.to, std::move(edge_weight), edge, std::move(extracted));
+					}
+			}
+			return false;
+		}
+		template<template<typename> typename heap_t, template<typename, typename> typename basic_queue_entry_t, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t, typename heuristic_t>
+		bool basic_astar(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable, heuristic_t heuristic)
+		{
+			heap_t<astar_queue_entry_type<basic_queue_entry_t, graph_t, weight_invokable_t>> queue;
+			return basic_astar<heap_t, basic_queue_entry_t, graph_t, visitor_t, has_been_visited_t, weight_invokable_t, heuristic_t>(graph, start, visitor, has_been_visited, weight_invokable, heuristic, queue);
+		}
+		// The visitor is hooked into workspace, which doubles as has_been_visited.
+		template<template<typename> typename heap_t, template<typename, typename> typename basic_queue_entry_t, typename graph_t, typename visitor_t, typename index_t, typename weight_invokable_t, typename heuristic_t>
+		bool basic_astar(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable, heuristic_t heuristic)
+		{
+			using queue_t = heap_t<astar_queue_entry_type<basic_queue_entry_t, graph_t, weight_invokable_t>>;
+			workspace.reset(graph.V.size());
+			auto hooked_visitor = workspace.hook_visitor(visitor);
+			return basic_astar<heap_t, basic_queue_entry_t, graph_t, decltype(hooked_visitor), search_workspace<index_t> const&, weight_invokable_t, heuristic_t>(graph, start, hooked_visitor, workspace, weight_invokable, heuristic, workspace.template buffer<queue_t>());
+		}
+	}
+
+	// Lets radix_heap order A* queue entries by their integral estimate, which a consistent heuristic keeps monotone.
+	template<typename dijkstra_queue_entry_t>
+	struct radix_heap_key<detail::astar_queue_entry_t<dijkstra_queue_entry_t>>
+	{
+		static constexpr auto get(detail::astar_queue_entry_t<dijkstra_queue_entry_t> const& entry) noexcept
+		{
+			return entry.estimate;
+		}
+	};
+
+	// A* search: Dijkstra with the queue ordered by distance + heuristic(vertex).
+	// Distances are dijkstra_distance_t<scalar_t>, so narrow weights are widened like for dijkstra.
+	// heuristic shall have the signature dijkstra_distance_t<scalar_t>(vertex_index_t) and shall be consistent,
+	// i.e. never overestimate the remaining distance and satisfy h(u) <= weight(u, v) + h(v) for every edge,
+	// so that vertices are still visited at their final distance.
+	// visitor shall have the signature bool(vertex_index_t, dijkstra_distance_t<scalar_t>).
+	// If visitor returns true, exit the search and return true.
+	// Returns false if no visitation returned true.
+	// has_been_visited shall have the signature bool(vertex_index_t)
+	// and shall return true iff the vertex has been visited by visitor.
+	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t).
+	// heap_t may be any heap that basic_dijkstra accepts, e.g. radix_heap for integral weights.
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t, typename heuristic_t>
+	bool astar(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable, heuristic_t heuristic)
+	{
+		using widened_t = detail::widened_weight_invokable_t<graph_t, weight_invokable_t>;
+		return detail::basic_astar<heap_t, detail::bind_dijkstra_queue_entry_t<>::templ, graph_t, visitor_t, has_been_visited_t, widened_t, heuristic_t>(graph, start, visitor, has_been_visited, detail::widened_weight_invokable<graph_t>(weight_invokable), heuristic);
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t, typename heuristic_t>
+	bool astar(graph_t& graph, vertex_index_t start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable, heuristic_t heuristic)
+	{
+		return astar<heap_t, graph_t, visitor_t, has_been_visited_t, weight_invokable_t, heuristic_t>(graph, std::ranges::single_view(start), visitor, has_been_visited, weight_invokable, heuristic);
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename visitor_t, typename weight_invokable_t, typename heuristic_t>
+	bool astar(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, weight_invokable_t weight_invokable, heuristic_t heuristic)
+	{
+		visitation_table_t visitation_table(graph);
+		return astar<heap_t, graph_t, decltype(visitation_table.hook_visitor(visitor)), visitation_table_t&, weight_invokable_t, heuristic_t>(graph, start, visitation_table.hook_visitor(visitor), visitation_table, weight_invokable, heuristic);
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename visitor_t, typename weight_invokable_t, typename heuristic_t>
+	bool astar(graph_t& graph, vertex_index_t start, visitor_t visitor, weight_invokable_t weight_invokable, heuristic_t heuristic)
+	{
+		return astar<heap_t, graph_t, visitor_t, weight_invokable_t, heuristic_t>(graph, std::ranges::single_view(start), visitor, weight_invokable, heuristic);
+	}
+	// Same as above, but workspace takes the place of has_been_visited and keeps the heap allocated between calls.
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename visitor_t, typename index_t, typename weight_invokable_t, typename heuristic_t>
+	bool astar(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable, heuristic_t heuristic)
+	{
+		return detail::basic_astar<heap_t, detail::bind_dijkstra_queue_entry_t<>::templ>(graph, start, visitor, workspace, detail::widened_weight_invokable<graph_t>(weight_invokable), heuristic);
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename visitor_t, typename index_t, typename weight_invokable_t, typename heuristic_t>
+	bool astar(graph_t& graph, vertex_index_t start, visitor_t visitor, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable, heuristic_t heuristic)
+	{
+		return astar<heap_t>(graph, std::ranges::single_view(start), visitor, workspace, weight_invokable, heuristic);
+	}
+
+	// visitor shall have the signature bool(vertex_index_t, dijkstra_distance_t<scalar_t>, vertex_index_t).
+	// Otherwise the same as astar.
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t, typename heuristic_t>
+	bool astar_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable, heuristic_t heuristic)
+	{
+		using widened_t = detail::widened_weight_invokable_t<graph_t, weight_invokable_t>;
+		return detail::basic_astar<heap_t, detail::bind_dijkstra_queue_entry_t<detail::dijkstra_predecessor_t>::templ, graph_t, visitor_t, has_been_visited_t, widened_t, heuristic_t>(graph, start, visitor, has_been_visited, detail::widened_weight_invokable<graph_t>(weight_invokable), heuristic);
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t, typename heuristic_t>
+	bool astar_shortest_path(graph_t& graph, vertex_index_t start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable, heuristic_t heuristic)
+	{
+		return astar_shortest_path<heap_t, graph_t, visitor_t, has_been_visited_t, weight_invokable_t, heuristic_t>(graph, std::ranges::single_view(start), visitor, has_been_visited, weight_invokable, heuristic);
+	}
+	// The constraint tells this apart from the overload taking a goal.
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename visitor_t, typename index_t, typename weight_invokable_t, typename heuristic_t>
+	requires std::predicate<visitor_t&, vertex_index_t, dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const typename graph_t::out_edge_t>>, vertex_index_t>
+	bool astar_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable, heuristic_t heuristic)
+	{
+		return detail::basic_astar<heap_t, detail::bind_dijkstra_queue_entry_t<detail::dijkstra_predecessor_t>::templ>(graph, start, visitor, workspace, detail::widened_weight_invokable<graph_t>(weight_invokable), heuristic);
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename visitor_t, typename index_t, typename weight_invokable_t, typename heuristic_t>
+	requires std::predicate<visitor_t&, vertex_index_t, dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const typename graph_t::out_edge_t>>, vertex_index_t>
+	bool astar_shortest_path(graph_t& graph, vertex_index_t start, visitor_t visitor, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable, heuristic_t heuristic)
+	{
+		return astar_shortest_path<heap_t>(graph, std::ranges::single_view(start), visitor, workspace, weight_invokable, heuristic);
+	}
+	namespace detail
+	{
+		// The workspace buffer of astar_shortest_path. It is never cleared,
+		// since only the entries of vertices visited by the current search are read.
+		template<typename index_t>
+		struct astar_predecessors
+		{
+			std::vector<index_t> predecessors;
+		};
+
+		// Runs search(visitor) until goal is visited, recording predecessors, and walks them back from goal.
+		template<typename scalar_t, typename index_t, typename search_t>
+		[[nodiscard]] auto astar_path(std::vector<index_t>& predecessors, index_t goal, search_t search)
+		{
+			std::pair<scalar_t, std::vector<index_t>> result(inf<scalar_t>, {});
+			auto visitor = [&](index_t vertex, scalar_t distance, index_t predecessor) -> bool {
+				predecessors[vertex] = predecessor;
+				if(vertex != goal)
+					return false;
+				result.first = distance;
+				return true;
+			};
+			if(search(std::move(visitor))) {
+				for(index_t index = goal;; index = predecessors[index]) {
+					result.second.push_back(index);
+					if(predecessors[index] == index)
+						break;
+				}
+				std::reverse(result.second.begin(), result.second.end());
+			}
+			return result;
+		}
+	}
+
+	// Searches until goal is visited.
+	// Return type is (distance, path from start to goal); if goal is unreachable, (inf, {}).
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename weight_invokable_t, typename heuristic_t>
+	[[nodiscard]] auto astar_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, vertex_index_t goal, weight_invokable_t weight_invokable, heuristic_t heuristic)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>>;
+		using vertex_index_t = vertex_index_type<graph_t>;
+		constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
+		assert(goal < graph.V.size());
+
+		std::vector<vertex_index_t> predecessors(graph.V.size(), no_predecessor);
+		auto has_been_visited = [&predecessors](vertex_index_t index){
+			return predecessors[index] != no_predecessor;
+		};
+		return detail::astar_path<scalar_t>(predecessors, static_cast<vertex_index_t>(goal), [&](auto visitor){
+			return astar_shortest_path<heap_t, graph_t, decltype(visitor), decltype(has_been_visited), weight_invokable_t, heuristic_t>(graph, start, std::move(visitor), has_been_visited, weight_invokable, heuristic);
+		});
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename weight_invokable_t, typename heuristic_t>
+	[[nodiscard]] auto astar_shortest_path(graph_t& graph, vertex_index_t start, vertex_index_t goal, weight_invokable_t weight_invokable, heuristic_t heuristic)
+	{
+		return astar_shortest_path<heap_t, graph_t, weight_invokable_t, heuristic_t>(graph, std::ranges::single_view(start), goal, weight_invokable, heuristic);
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename heuristic_t>
+	[[nodiscard]] auto astar_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, vertex_index_t goal, heuristic_t heuristic)
+	{
+		return astar_shortest_path<heap_t>(graph, start, goal, dijkstra_default_weight_invokable<graph_t>(), heuristic);
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename heuristic_t>
+	[[nodiscard]] auto astar_shortest_path(graph_t& graph, vertex_index_t start, vertex_index_t goal, heuristic_t heuristic)
+	{
+		return astar_shortest_path<heap_t, graph_t, heuristic_t>(graph, std::ranges::single_view(start), goal, heuristic);
+	}
+	// Same as above, but the costs are proportional to the explored part of the graph,
+	// since workspace provides the visited marks, the heap and the predecessors.
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename index_t, typename weight_invokable_t, typename heuristic_t>
+	[[nodiscard]] auto astar_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, vertex_index_t goal, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable, heuristic_t heuristic)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>>;
+		using vertex_index_t = vertex_index_type<graph_t>;
+		assert(goal < graph.V.size());
+
+		std::vector<vertex_index_t>& predecessors = workspace.template buffer<detail::astar_predecessors<vertex_index_t>>().predecessors;
+		if(predecessors.size() < graph.V.size())
+			predecessors.resize(graph.V.size());
+		return detail::astar_path<scalar_t>(predecessors, static_cast<vertex_index_t>(goal), [&](auto visitor){
+			return astar_shortest_path<heap_t>(graph, start, std::move(visitor), workspace, weight_invokable, heuristic);
+		});
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename index_t, typename weight_invokable_t, typename heuristic_t>
+	[[nodiscard]] auto astar_shortest_path(graph_t& graph, vertex_index_t start, vertex_index_t goal, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable, heuristic_t heuristic)
+	{
+		return astar_shortest_path<heap_t>(graph, std::ranges::single_view(start), goal, workspace, weight_invokable, heuristic);
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename index_t, typename heuristic_t>
+	[[nodiscard]] auto astar_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, vertex_index_t goal, search_workspace<index_t>& workspace, heuristic_t heuristic)
+	{
+		return astar_shortest_path<heap_t>(graph, start, goal, workspace, dijkstra_default_weight_invokable<graph_t>(), heuristic);
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename index_t, typename heuristic_t>
+	[[nodiscard]] auto astar_shortest_path(graph_t& graph, vertex_index_t start, vertex_index_t goal, search_workspace<index_t>& workspace, heuristic_t heuristic)
+	{
+		return astar_shortest_path<heap_t>(graph, std::ranges::single_view(start), goal, workspace, heuristic);
+	}
+}
+
+#endif // !QUIVER_SEARCH_ASTAR_HPP_INCLUDED
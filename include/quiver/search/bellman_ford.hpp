@@ -0,0 +1,324 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_BELLMAN_FORD_HPP_INCLUDED
+#define QUIVER_SEARCH_BELLMAN_FORD_HPP_INCLUDED
+
+#include <quiver/search/dijkstra.hpp>
+#include <quiver/adjacency_list.hpp>
+#include <quiver/thread_pool.hpp>
+#include <quiver/exception.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <ranges>
+#include <vector>
+#include <deque>
+#include <utility>
+#include <cstddef>
+#include <cassert>
+
+namespace quiver
+{
+	namespace detail
+	{
+		template<typename graph_t, typename weight_invokable_t>
+		using bellman_ford_result_t = std::vector<std::pair<std::invoke_result_t<weight_invokable_t, vertex_index_t, const typename graph_t::out_edge_t>, vertex_index_type<graph_t>>>;
+
+		// A cycle of the predecessor graph in edge order, or {} if it is a forest.
+		// While relaxations strictly decrease distances, every such cycle is a negative cycle.
+		template<typename scalar_t, typename vertex_index_t>
+		std::vector<vertex_index_t> predecessor_cycle(std::vector<std::pair<scalar_t, vertex_index_t>> const& result)
+		{
+			constexpr vertex_index_t none = ~vertex_index_t{};
+			std::vector<vertex_index_t> walk(result.size(), none); // the vertex each walk started from
+			for(std::size_t start = 0; start < result.size(); ++start) {
+				vertex_index_t index = static_cast<vertex_index_t>(start);
+				while(index != none && walk[index] == none) {
+					walk[index] = static_cast<vertex_index_t>(start);
+					const vertex_index_t predecessor = result[index].second;
+					index = predecessor == index ? none : predecessor;
+				}
+				if(index == none || walk[index] != start)
+					continue;
+
+				std::vector<vertex_index_t> cycle;
+				vertex_index_t current = index;
+				do {
+					cycle.push_back(current);
+					current = result[current].second;
+				} while(current != index);
+				std::reverse(cycle.begin(), cycle.end());
+				return cycle;
+			}
+			return {};
+		}
+
+		template<typename graph_t, typename weight_invokable_t>
+		auto basic_bellman_ford(graph_t& graph, std::ranges::input_range auto const& start, weight_invokable_t weight_invokable)
+		{
+			using out_edge_t = typename graph_t::out_edge_t;
+			using scalar_t = std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>;
+			using vertex_index_t = vertex_index_type<graph_t>;
+			constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
+
+			const std::size_t V = graph.V.size();
+			std::pair<bellman_ford_result_t<graph_t, weight_invokable_t>, std::vector<vertex_index_t>> result;
+			auto& [distances, cycle] = result;
+			distances.assign(V, { inf<scalar_t>, no_predecessor });
+			for(vertex_index_t index : start) {
+				assert(index < V);
+				distances[index] = { scalar_t(0), index };
+			}
+
+			// a round that still relaxes an edge after V - 1 rounds may have closed a cycle
+			for(std::size_t round = 1;; ++round) {
+				bool changed = false;
+				for(std::size_t from = 0; from < V; ++from) {
+					if(distances[from].second == no_predecessor)
+						continue;
+					for(out_edge_t const& edge : graph.V[from].out_edges) {
+						const scalar_t weight = weight_invokable(from, edge);
+						if(edge.to == from && weight < scalar_t(0)) {
+							cycle = { static_cast<vertex_index_t>(from) };
+							return result;
+						}
+						const scalar_t candidate = distances[from].first + weight;
+						if(distances[edge.to].second == no_predecessor || candidate < distances[edge.to].first) {
+							distances[edge.to] = { candidate, static_cast<vertex_index_t>(from) };
+							changed = true;
+						}
+					}
+				}
+				if(!changed)
+					return result;
+				if(round >= V && !(cycle = predecessor_cycle(distances)).empty())
+					return result;
+			}
+		}
+
+		template<typename graph_t, typename weight_invokable_t>
+		auto basic_spfa(graph_t& graph, std::ranges::input_range auto const& start, weight_invokable_t weight_invokable)
+		{
+			using out_edge_t = typename graph_t::out_edge_t;
+			using scalar_t = std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>;
+			using vertex_index_t = vertex_index_type<graph_t>;
+			constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
+
+			const std::size_t V = graph.V.size();
+			std::pair<bellman_ford_result_t<graph_t, weight_invokable_t>, std::vector<vertex_index_t>> result;
+			auto& [distances, cycle] = result;
+			distances.assign(V, { inf<scalar_t>, no_predecessor });
+			std::vector<std::size_t> length(V, 0); // the number of edges of the current path
+			std::vector<bool> queued(V, false);
+			std::deque<vertex_index_t> queue;
+			for(vertex_index_t index : start) {
+				assert(index < V);
+				distances[index] = { scalar_t(0), index };
+				if(!queued[index]) {
+					queued[index] = true;
+					queue.push_back(index);
+				}
+			}
+
+			while(!queue.empty()) {
+				const vertex_index_t from = queue.front();
+				queue.pop_front();
+				queued[from] = false;
+				for(out_edge_t const& edge : graph.V[from].out_edges) {
+					const scalar_t weight = weight_invokable(std::as_const(from), edge);
+					if(edge.to == from && weight < scalar_t(0)) {
+						cycle = { from };
+						return result;
+					}
+					const scalar_t candidate = distances[from].first + weight;
+					if(distances[edge.to].second != no_predecessor && !(candidate < distances[edge.to].first))
+						continue;
+					distances[edge.to] = { candidate, from };
+					length[edge.to] = length[from] + 1;
+					// a path of V edges repeats a vertex
+					if(length[edge.to] >= V && !(cycle = predecessor_cycle(distances)).empty())
+						return result;
+					if(!queued[edge.to]) {
+						queued[edge.to] = true;
+						queue.push_back(edge.to);
+					}
+				}
+			}
+			return result;
+		}
+
+		template<typename vertex_index_t>
+		[[noreturn]] void throw_negative_cycle(char const* what, std::vector<vertex_index_t> const& cycle)
+		{
+			throw negative_cycle(what, std::vector<quiver::vertex_index_t>(cycle.begin(), cycle.end()));
+		}
+	}
+
+	// Single source shortest paths for arbitrary weights, relaxing every edge per round until nothing changes.
+	// Return type is a map from vertex index to (distance from start, predecessor), like dijkstra_shortest_path,
+	// including the widening of narrow weights to dijkstra_distance_t.
+	// Throws negative_cycle with the cycle if a negative cycle is reachable from start.
+	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t).
+	// time complexity:  O(V * E)
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto bellman_ford_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, weight_invokable_t weight_invokable)
+	{
+		auto [distances, cycle] = detail::basic_bellman_ford(graph, start, detail::widened_weight_invokable<graph_t>(weight_invokable));
+		if(!cycle.empty())
+			detail::throw_negative_cycle("bellman_ford_shortest_path: negative cycle", cycle);
+		return std::move(distances);
+	}
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto bellman_ford_shortest_path(graph_t& graph, vertex_index_t start, weight_invokable_t weight_invokable)
+	{
+		return bellman_ford_shortest_path<graph_t, weight_invokable_t>(graph, std::ranges::single_view(start), weight_invokable);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto bellman_ford_shortest_path(graph_t& graph, std::ranges::input_range auto const& start)
+	{
+		return bellman_ford_shortest_path(graph, start, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto bellman_ford_shortest_path(graph_t& graph, vertex_index_t start)
+	{
+		return bellman_ford_shortest_path<graph_t>(graph, std::ranges::single_view(start));
+	}
+
+	// Bellman-Ford that only rescans the vertices whose distance changed, kept in a FIFO queue
+	// (shortest path faster algorithm). Usually much faster than bellman_ford_shortest_path, with the same worst case.
+	// Same contract as bellman_ford_shortest_path.
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto spfa_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, weight_invokable_t weight_invokable)
+	{
+		auto [distances, cycle] = detail::basic_spfa(graph, start, detail::widened_weight_invokable<graph_t>(weight_invokable));
+		if(!cycle.empty())
+			detail::throw_negative_cycle("spfa_shortest_path: negative cycle", cycle);
+		return std::move(distances);
+	}
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto spfa_shortest_path(graph_t& graph, vertex_index_t start, weight_invokable_t weight_invokable)
+	{
+		return spfa_shortest_path<graph_t, weight_invokable_t>(graph, std::ranges::single_view(start), weight_invokable);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto spfa_shortest_path(graph_t& graph, std::ranges::input_range auto const& start)
+	{
+		return spfa_shortest_path(graph, start, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto spfa_shortest_path(graph_t& graph, vertex_index_t start)
+	{
+		return spfa_shortest_path<graph_t>(graph, std::ranges::single_view(start));
+	}
+
+	// Bellman-Ford with the vertices of each round distributed over pool. Every vertex pulls the minimum over its
+	// in-edges from the distances of the previous round, so the threads never write to shared entries.
+	// The in-edges are indexed once as (from, out-edge of from), so weight_invokable sees the edges of graph
+	// in their own orientation, at the cost of O(V + E) extra memory.
+	// Same contract as bellman_ford_shortest_path.
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto parallel_bellman_ford_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, weight_invokable_t narrow_weight_invokable, thread_pool& pool)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>>;
+		using vertex_index_t = vertex_index_type<graph_t>;
+		constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
+		const auto weight_invokable = detail::widened_weight_invokable<graph_t>(narrow_weight_invokable);
+
+		const std::size_t V = graph.V.size();
+		std::vector<std::size_t> in_offsets(V + 1, 0);
+		for(std::size_t from = 0; from < V; ++from)
+			for(out_edge_t const& edge : graph.V[from].out_edges)
+				++in_offsets[edge.to + 1];
+		for(std::size_t index = 0; index < V; ++index)
+			in_offsets[index + 1] += in_offsets[index];
+		std::vector<std::pair<vertex_index_t, out_edge_t const*>> in_edges(in_offsets.back());
+		{
+			std::vector<std::size_t> cursor(in_offsets.begin(), in_offsets.end() - 1);
+			for(std::size_t from = 0; from < V; ++from)
+				for(out_edge_t const& edge : graph.V[from].out_edges)
+					in_edges[cursor[edge.to]++] = { static_cast<vertex_index_t>(from), &edge };
+		}
+
+		std::vector<std::pair<scalar_t, vertex_index_t>> current(V, { inf<scalar_t>, no_predecessor }), next;
+		for(vertex_index_t index : start) {
+			assert(index < V);
+			current[index] = { scalar_t(0), index };
+		}
+		next = current;
+
+		std::vector<char> changed(pool.size());
+		std::vector<vertex_index_t> negative_loop(pool.size(), no_predecessor);
+		for(std::size_t round = 1;; ++round) {
+			std::fill(changed.begin(), changed.end(), false);
+			pool.for_each(V, [&](std::size_t thread_index, std::size_t to){
+				std::pair<scalar_t, vertex_index_t> best = current[to];
+				for(std::size_t i = in_offsets[to]; i < in_offsets[to + 1]; ++i) {
+					const auto [from, edge] = in_edges[i];
+					if(current[from].second == no_predecessor)
+						continue;
+					const scalar_t weight = weight_invokable(from, *edge);
+					if(from == to && weight < scalar_t(0))
+						negative_loop[thread_index] = from;
+					const scalar_t candidate = current[from].first + weight;
+					if(best.second == no_predecessor || candidate < best.first)
+						best = { candidate, from };
+				}
+				if(best != current[to])
+					changed[thread_index] = true;
+				next[to] = best;
+			});
+			for(vertex_index_t index : negative_loop)
+				if(index != no_predecessor)
+					detail::throw_negative_cycle("parallel_bellman_ford_shortest_path: negative cycle", std::vector<vertex_index_t>{ index });
+			current.swap(next);
+			if(std::find(changed.begin(), changed.end(), true) == changed.end())
+				return current;
+			if(round >= V)
+				if(const auto cycle = detail::predecessor_cycle(current); !cycle.empty())
+					detail::throw_negative_cycle("parallel_bellman_ford_shortest_path: negative cycle", cycle);
+		}
+	}
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto parallel_bellman_ford_shortest_path(graph_t& graph, vertex_index_t start, weight_invokable_t weight_invokable, thread_pool& pool)
+	{
+		return parallel_bellman_ford_shortest_path<graph_t, weight_invokable_t>(graph, std::ranges::single_view(start), weight_invokable, pool);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto parallel_bellman_ford_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, thread_pool& pool)
+	{
+		return parallel_bellman_ford_shortest_path(graph, start, dijkstra_default_weight_invokable<graph_t>(), pool);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto parallel_bellman_ford_shortest_path(graph_t& graph, vertex_index_t start, thread_pool& pool)
+	{
+		return parallel_bellman_ford_shortest_path<graph_t>(graph, std::ranges::single_view(start), pool);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto parallel_bellman_ford_shortest_path(graph_t& graph, vertex_index_t start)
+	{
+		thread_pool pool;
+		return parallel_bellman_ford_shortest_path<graph_t>(graph, start, pool);
+	}
+
+	// A negative cycle anywhere in graph, in edge order, or {} if there is none.
+	// Runs Bellman-Ford from all vertices at once, as if from an additional vertex with zero-weight edges to all of them.
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto find_negative_cycle(graph_t& graph, weight_invokable_t weight_invokable)
+	{
+		using vertex_index_t = vertex_index_type<graph_t>;
+		return detail::basic_bellman_ford(graph, std::views::iota(vertex_index_t(0), static_cast<vertex_index_t>(graph.V.size())), detail::widened_weight_invokable<graph_t>(weight_invokable)).second;
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto find_negative_cycle(graph_t& graph)
+	{
+		return find_negative_cycle(graph, dijkstra_default_weight_invokable<graph_t>());
+	}
+}
+
+#endif // !QUIVER_SEARCH_BELLMAN_FORD_HPP_INCLUDED
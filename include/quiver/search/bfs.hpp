@@ -9,11 +9,12 @@
 #define QUIVER_SEARCH_BFS_HPP_INCLUDED
 
 #include <quiver/search/visitation_table.hpp>
+#include <quiver/search/search_workspace.hpp>
 #include <quiver/adjacency_list.hpp>
 #include <quiver/util.hpp>
 #include <ranges>
 #include <vector>
-#include <queue>
+#include <tuple>
 #include <cassert>
 
 namespace quiver
@@ -25,6 +26,7 @@ namespace quiver
 		template<typename out_edge_t, template<typename, typename> typename... additional_t>
 		struct bfs_queue_entry_t : public additional_t<out_edge_t, bfs_queue_entry_t<out_edge_t, additional_t...>>...
 		{
+			using vertex_index_t = typename out_edge_t::vertex_index_t;
 			vertex_index_t index;
 
 			[[nodiscard]] constexpr bfs_queue_entry_t(vertex_index_t index)
@@ -53,6 +55,7 @@ namespace quiver
 		template<typename out_edge_t, typename bfs_queue_entry_t>
 		struct bfs_distance_t
 		{
+			using vertex_index_t = typename out_edge_t::vertex_index_t;
 			bfs_path_length_t distance;
 
 			[[nodiscard]] constexpr bfs_distance_t(vertex_index_t index) noexcept
@@ -76,6 +79,7 @@ namespace quiver
 		template<typename out_edge_t, typename bfs_queue_entry_t>
 		struct bfs_predecessor_t
 		{
+			using vertex_index_t = typename out_edge_t::vertex_index_t;
 			vertex_index_t predecessor;
 
 			[[nodiscard]] constexpr bfs_predecessor_t(vertex_index_t index) noexcept
@@ -97,38 +101,55 @@ namespace quiver
 
 		// TODO: can we somehow remove "enqueued" in favor of "has_been_visited" but without allowing multiple insertions into the queue?
 
-		template<template<typename> typename basic_queue_entry_t, typename graph_t, typename visitor_t>
-		bool basic_bfs(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor)
+		// enqueued shall provide set(vertex_index_t) and bool(vertex_index_t) like visitation_table_t.
+		// neighbors is used as a FIFO queue; every vertex is appended at most once.
+		template<template<typename> typename basic_queue_entry_t, typename graph_t, typename visitor_t, typename enqueued_t>
+		bool basic_bfs(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, enqueued_t& enqueued, std::vector<basic_queue_entry_t<typename graph_t::out_edge_t>>& neighbors)
 		{
 			using vertex_t = copy_const<graph_t, typename graph_t::vertex_t>;
 			using out_edge_t = typename graph_t::out_edge_t;
 			using queue_entry_t = basic_queue_entry_t<out_edge_t>;
 
-			std::vector<bool> enqueued(graph.V.size(), false);
-			std::queue<queue_entry_t> neighbors;
+			neighbors.clear();
 			for(vertex_index_t index : start) {
 				assert(index < graph.V.size());
-				enqueued[index] = true;
-				neighbors.emplace(index);
+				if(!enqueued(index)) {
+					enqueued.set(index);
+					neighbors.emplace_back(index);
+				}
 			}
 
-			do {
-				queue_entry_t front = neighbors.front();
-				assert(enqueued[front.index]);
+			for(std::size_t head = 0; head < neighbors.size(); ++head) {
+				// copy, since emplace_back may reallocate
+				queue_entry_t front = neighbors[head];
+				assert(enqueued(front.index));
 				vertex_t& vertex = graph.V[front.index];
 
 				if(front.apply_to(visitor))
 					return true;
 
-				neighbors.pop();
 				for(out_edge_t const& edge : vertex.out_edges)
-					if(!enqueued[edge.to]) {
-						neighbors.emplace(edge.to, edge, std::move(front));
-						enqueued[edge.to] = true;
+					if(!enqueued(edge.to)) {
+						enqueued.set(edge.to);
+						neighbors.emplace_back(edge.to, edge, std::move(front));
 					}
-			} while(!neighbors.empty());
+			}
 			return false;
 		}
+		template<template<typename> typename basic_queue_entry_t, typename graph_t, typename visitor_t>
+		bool basic_bfs(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor)
+		{
+			visitation_table_t enqueued(graph);
+			std::vector<basic_queue_entry_t<typename graph_t::out_edge_t>> neighbors;
+			return basic_bfs<basic_queue_entry_t>(graph, start, visitor, enqueued, neighbors);
+		}
+		template<template<typename> typename basic_queue_entry_t, typename graph_t, typename visitor_t, typename index_t>
+		bool basic_bfs(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<index_t>& workspace)
+		{
+			using queue_t = std::vector<basic_queue_entry_t<typename graph_t::out_edge_t>>;
+			workspace.reset(graph.V.size());
+			return basic_bfs<basic_queue_entry_t>(graph, start, visitor, workspace, workspace.template buffer<queue_t>());
+		}
 	}
 
 	// visitor shall have the signature bool(vertex_index_t).
@@ -144,6 +165,17 @@ namespace quiver
 	{
 		return bfs<graph_t, visitor_t>(graph, std::ranges::single_view(start), visitor);
 	}
+	// Same as above, but reuses the marks and the queue of workspace instead of allocating them.
+	template<typename graph_t, typename visitor_t, typename index_t>
+	bool bfs(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<index_t>& workspace)
+	{
+		return detail::basic_bfs<detail::bind_bfs_queue_entry_t<>::templ>(graph, start, visitor, workspace);
+	}
+	template<typename graph_t, typename visitor_t, typename index_t>
+	bool bfs(graph_t& graph, vertex_index_t start, visitor_t visitor, search_workspace<index_t>& workspace)
+	{
+		return bfs(graph, std::ranges::single_view(start), visitor, workspace);
+	}
 
 	// visitor shall have the signature bool(vertex_index_t, bfs_path_length_t, vertex_index_t).
 	// If visitor returns true, exit the search and return true.
@@ -164,6 +196,7 @@ namespace quiver
 	template<typename graph_t>
 	[[nodiscard]] auto bfs_shortest_path(graph_t& graph, std::ranges::input_range auto const& start)
 	{
+		using vertex_index_t = vertex_index_type<graph_t>;
 		constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
 		std::vector<std::pair<bfs_path_length_t, vertex_index_t>> result(graph.V.size(), { inf<bfs_path_length_t>, no_predecessor });
 		auto visitor = [&result](vertex_index_t vertex, bfs_path_length_t distance, vertex_index_t predecessor) -> bool {
@@ -180,6 +213,36 @@ namespace quiver
 		return bfs_shortest_path<graph_t>(graph, std::ranges::single_view(start));
 	}
 
+	template<typename graph_t, typename visitor_t, typename index_t>
+	bool bfs_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<index_t>& workspace)
+	{
+		return detail::basic_bfs<detail::bind_bfs_queue_entry_t<detail::bfs_distance_t, detail::bfs_predecessor_t>::templ>(graph, start, visitor, workspace);
+	}
+	template<typename graph_t, typename visitor_t, typename index_t>
+	bool bfs_shortest_path(graph_t& graph, vertex_index_t start, visitor_t visitor, search_workspace<index_t>& workspace)
+	{
+		return bfs_shortest_path(graph, std::ranges::single_view(start), visitor, workspace);
+	}
+	// Return type is a list of (vertex index, distance from start, predecessor) for the reached vertices only,
+	// in the order they were visited. Costs are proportional to the explored part of the graph.
+	template<typename graph_t, typename index_t>
+	[[nodiscard]] auto bfs_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, search_workspace<index_t>& workspace)
+	{
+		using vertex_index_t = vertex_index_type<graph_t>;
+		std::vector<std::tuple<vertex_index_t, bfs_path_length_t, vertex_index_t>> result;
+		auto visitor = [&result](vertex_index_t vertex, bfs_path_length_t distance, vertex_index_t predecessor) -> bool {
+			result.emplace_back(vertex, distance, predecessor);
+			return false;
+		};
+		bfs_shortest_path(graph, start, std::move(visitor), workspace);
+		return result;
+	}
+	template<typename graph_t, typename index_t>
+	[[nodiscard]] auto bfs_shortest_path(graph_t& graph, vertex_index_t start, search_workspace<index_t>& workspace)
+	{
+		return bfs_shortest_path(graph, std::ranges::single_view(start), workspace);
+	}
+
 	// TODO: the same TODOs as for dijkstra_shortest_path
 }
 
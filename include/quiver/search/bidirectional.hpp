@@ -0,0 +1,232 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_BIDIRECTIONAL_HPP_INCLUDED
+#define QUIVER_SEARCH_BIDIRECTIONAL_HPP_INCLUDED
+
+#include <quiver/search/bfs.hpp>
+#include <quiver/search/dijkstra.hpp>
+#include <quiver/adjacency_list.hpp>
+#include <quiver/heaps.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <cassert>
+
+namespace quiver
+{
+	namespace detail
+	{
+		// s, ..., meet from predecessors of the search from s, then meet, ..., t from predecessors of the search from t
+		template<typename vertex_index_t>
+		std::vector<vertex_index_t> join_paths(std::vector<vertex_index_t> const& forward_predecessor, std::vector<vertex_index_t> const& backward_predecessor, vertex_index_t meet)
+		{
+			std::vector<vertex_index_t> path;
+			for(vertex_index_t index = meet;; index = forward_predecessor[index]) {
+				path.push_back(index);
+				if(forward_predecessor[index] == index)
+					break;
+			}
+			std::reverse(path.begin(), path.end());
+			for(vertex_index_t index = meet; backward_predecessor[index] != index;) {
+				index = backward_predecessor[index];
+				path.push_back(index);
+			}
+			return path;
+		}
+
+		template<typename graph_t, typename in_graph_t, typename weight_invokable_t>
+		auto basic_bidirectional_dijkstra(graph_t& graph, in_graph_t const& in_graph, vertex_index_t source, vertex_index_t target, weight_invokable_t narrow_weight_invokable)
+		{
+			using out_edge_t = typename graph_t::out_edge_t;
+			using scalar_t = dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>>;
+			using vertex_index_t = vertex_index_type<graph_t>;
+			using result_t = std::pair<scalar_t, std::vector<vertex_index_t>>;
+			constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
+
+			const std::size_t V = graph.V.size();
+			assert(in_graph.V.size() == V);
+			assert(source < V);
+			assert(target < V);
+			if(source == target)
+				return result_t(scalar_t(0), { static_cast<vertex_index_t>(source) });
+			const auto weight_invokable = widened_weight_invokable<graph_t>(narrow_weight_invokable);
+
+			struct side_t
+			{
+				std::vector<scalar_t> distance;
+				std::vector<vertex_index_t> predecessor;
+				std::vector<bool> settled;
+				min_heap<std::pair<scalar_t, vertex_index_t>> queue;
+
+				side_t(std::size_t V, vertex_index_t start)
+				: distance(V, inf<scalar_t>), predecessor(V, ~vertex_index_t{}), settled(V, false)
+				{
+					distance[start] = scalar_t(0);
+					predecessor[start] = start;
+					queue.push(scalar_t(0), start);
+				}
+			};
+			side_t forward(V, source), backward(V, target);
+
+			bool found = false;
+			scalar_t best = inf<scalar_t>;
+			vertex_index_t meet = no_predecessor;
+			const auto expand = [&](auto const& g, side_t& side, side_t const& other){
+				const vertex_index_t index = side.queue.extract_top().second;
+				if(side.settled[index])
+					return;
+				side.settled[index] = true;
+				const scalar_t distance = side.distance[index];
+				for(auto const& edge : g.V[index].out_edges) {
+					const scalar_t candidate = distance + weight_invokable(index, edge);
+					assert(!(candidate < distance));
+					if(side.predecessor[edge.to] == no_predecessor || candidate < side.distance[edge.to]) {
+						side.distance[edge.to] = candidate;
+						side.predecessor[edge.to] = index;
+						side.queue.push(candidate, edge.to);
+					}
+					if(other.predecessor[edge.to] != no_predecessor && (!found || side.distance[edge.to] + other.distance[edge.to] < best)) {
+						found = true;
+						best = side.distance[edge.to] + other.distance[edge.to];
+						meet = edge.to;
+					}
+				}
+			};
+			// stop once no path through an unsettled vertex can be shorter than the best one found
+			while(!forward.queue.empty() && !backward.queue.empty()) {
+				if(found && !(forward.queue.top().first + backward.queue.top().first < best))
+					break;
+				if(forward.queue.size() <= backward.queue.size())
+					expand(graph, forward, backward);
+				else
+					expand(in_graph, backward, forward);
+			}
+
+			if(!found)
+				return result_t(inf<scalar_t>, {});
+			return result_t(best, join_paths(forward.predecessor, backward.predecessor, meet));
+		}
+
+		template<typename graph_t, typename in_graph_t>
+		auto basic_bidirectional_bfs(graph_t& graph, in_graph_t const& in_graph, vertex_index_t source, vertex_index_t target)
+		{
+			using vertex_index_t = vertex_index_type<graph_t>;
+			using result_t = std::pair<bfs_path_length_t, std::vector<vertex_index_t>>;
+			constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
+
+			const std::size_t V = graph.V.size();
+			assert(in_graph.V.size() == V);
+			assert(source < V);
+			assert(target < V);
+			if(source == target)
+				return result_t(0, { static_cast<vertex_index_t>(source) });
+
+			struct side_t
+			{
+				std::vector<bfs_path_length_t> distance;
+				std::vector<vertex_index_t> predecessor;
+				std::vector<vertex_index_t> frontier;
+
+				side_t(std::size_t V, vertex_index_t start)
+				: distance(V, inf<bfs_path_length_t>), predecessor(V, ~vertex_index_t{}), frontier{ start }
+				{
+					distance[start] = 0;
+					predecessor[start] = start;
+				}
+			};
+			side_t forward(V, source), backward(V, target);
+			std::vector<vertex_index_t> next;
+
+			// Expands a whole level of the smaller frontier. Once an edge reaches the other side,
+			// the shortest connection over all edges of this level is a shortest path.
+			while(!forward.frontier.empty() && !backward.frontier.empty()) {
+				const bool is_forward = forward.frontier.size() <= backward.frontier.size();
+				side_t& side = is_forward ? forward : backward;
+				side_t const& other = is_forward ? backward : forward;
+
+				bfs_path_length_t best = inf<bfs_path_length_t>;
+				vertex_index_t meet_from = no_predecessor, meet_to = no_predecessor;
+				next.clear();
+				const auto expand = [&](auto const& g){
+					for(vertex_index_t index : side.frontier)
+						for(auto const& edge : g.V[index].out_edges) {
+							if(other.distance[edge.to] != inf<bfs_path_length_t> && side.distance[index] + 1 + other.distance[edge.to] < best) {
+								best = side.distance[index] + 1 + other.distance[edge.to];
+								meet_from = index;
+								meet_to = edge.to;
+							}
+							if(side.predecessor[edge.to] == no_predecessor) {
+								side.distance[edge.to] = side.distance[index] + 1;
+								side.predecessor[edge.to] = index;
+								next.push_back(edge.to);
+							}
+						}
+				};
+				if(is_forward)
+					expand(graph);
+				else
+					expand(in_graph);
+
+				if(best != inf<bfs_path_length_t>) {
+					// the meeting edge joins the two predecessor trees at meet_to
+					side.predecessor[meet_to] = meet_from;
+					return result_t(best, join_paths(forward.predecessor, backward.predecessor, meet_to));
+				}
+				side.frontier.swap(next);
+			}
+			return result_t(inf<bfs_path_length_t>, {});
+		}
+	}
+
+	// Point-to-point shortest path, searching from source and target alternately until the searches meet.
+	// For directed graphs, transposed shall be transpose(graph), which provides the in-edges.
+	// weight_invokable is called with the edges of transposed for the search from target.
+	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t).
+	// Return type is (distance, path from source to target) with the distance dijkstra_distance_t<scalar_t>;
+	// if target is unreachable, (inf, {}).
+	template<typename graph_t, typename transposed_t, typename weight_invokable_t>
+	[[nodiscard]] auto bidirectional_dijkstra(graph_t& graph, transposed_t const& transposed, vertex_index_t source, vertex_index_t target, weight_invokable_t weight_invokable)
+	{
+		return detail::basic_bidirectional_dijkstra(graph, transposed, source, target, weight_invokable);
+	}
+	template<typename graph_t, typename transposed_t>
+	[[nodiscard]] auto bidirectional_dijkstra(graph_t& graph, transposed_t const& transposed, vertex_index_t source, vertex_index_t target)
+	{
+		return bidirectional_dijkstra(graph, transposed, source, target, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto bidirectional_dijkstra(graph_t& graph, vertex_index_t source, vertex_index_t target, weight_invokable_t weight_invokable)
+	{
+		static_assert(is_undirected_v<std::remove_const_t<graph_t>>, "directed graphs need their transpose for the search from target");
+		return detail::basic_bidirectional_dijkstra(graph, graph, source, target, weight_invokable);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto bidirectional_dijkstra(graph_t& graph, vertex_index_t source, vertex_index_t target)
+	{
+		return bidirectional_dijkstra(graph, source, target, dijkstra_default_weight_invokable<graph_t>());
+	}
+
+	// Like bidirectional_dijkstra with unit weights, expanding whole levels of the smaller frontier.
+	// Return type is (number of edges, path from source to target); if target is unreachable, (inf, {}).
+	template<typename graph_t, typename transposed_t>
+	[[nodiscard]] auto bidirectional_bfs(graph_t& graph, transposed_t const& transposed, vertex_index_t source, vertex_index_t target)
+	{
+		return detail::basic_bidirectional_bfs(graph, transposed, source, target);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto bidirectional_bfs(graph_t& graph, vertex_index_t source, vertex_index_t target)
+	{
+		static_assert(is_undirected_v<std::remove_const_t<graph_t>>, "directed graphs need their transpose for the search from target");
+		return detail::basic_bidirectional_bfs(graph, graph, source, target);
+	}
+}
+
+#endif // !QUIVER_SEARCH_BIDIRECTIONAL_HPP_INCLUDED
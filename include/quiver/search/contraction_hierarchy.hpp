@@ -0,0 +1,439 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_CONTRACTION_HIERARCHY_HPP_INCLUDED
+#define QUIVER_SEARCH_CONTRACTION_HIERARCHY_HPP_INCLUDED
+
+#include <quiver/search/dijkstra.hpp>
+#include <quiver/search/search_workspace.hpp>
+#include <quiver/adjacency_list.hpp>
+#include <quiver/heaps.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <span>
+#include <cstddef>
+#include <cassert>
+
+namespace quiver
+{
+	// A contraction hierarchy (Geisberger et al.) of a static weighted graph for fast point-to-point queries.
+	// Vertices are contracted one by one in the order of their edge difference. Contracting v adds a shortcut
+	// u -> w with middle vertex v for every path u -> v -> w that has no equally short witness path avoiding v.
+	// Every vertex keeps the arcs to the vertices contracted after it: its upward arcs in the edge direction and
+	// its downward arcs against it, both in compressed sparse row form.
+	// A shortest path then always consists of upward arcs from s and downward arcs into t,
+	// so a query only has to search upwards from both ends, see contraction_hierarchy_query.
+	// Shortcut weights are sums of edge weights, so scalar_t is dijkstra_distance_t of the weights, which the deduction guides pick.
+	template<typename scalar_t, typename index_t = vertex_index_t>
+	class contraction_hierarchy
+	{
+		static_assert(!is_dial_weight_v<scalar_t>, "shortcuts of narrow weights would wrap around, use dijkstra_distance_t<scalar_t>");
+
+	public:
+		using vertex_index_t = index_t;
+		using scalar_type = scalar_t;
+
+		static constexpr vertex_index_t no_middle = ~vertex_index_t{};
+
+		struct arc_t
+		{
+			vertex_index_t to;
+			scalar_t weight;
+			vertex_index_t middle; // no_middle for arcs of the original graph
+		};
+
+		// A witness search gives up after settling this many vertices. This only costs superfluous shortcuts.
+		static constexpr std::size_t witness_settle_limit = 500;
+
+	private:
+		std::vector<vertex_index_t> m_rank;
+		std::vector<std::size_t> m_up_offsets, m_down_offsets;
+		std::vector<arc_t> m_up_arcs; // arc.to has a higher rank, the arc leads from the vertex to arc.to
+		std::vector<arc_t> m_down_arcs; // arc.to has a higher rank, the arc leads from arc.to to the vertex
+
+		static void build_csr(std::vector<std::vector<arc_t>>& lists, std::vector<std::size_t>& offsets, std::vector<arc_t>& arcs)
+		{
+			offsets.assign(lists.size() + 1, 0);
+			for(std::size_t i = 0; i < lists.size(); ++i)
+				offsets[i + 1] = offsets[i] + lists[i].size();
+			arcs.clear();
+			arcs.reserve(offsets.back());
+			for(auto& list : lists) {
+				arcs.insert(arcs.end(), list.begin(), list.end());
+				std::vector<arc_t>().swap(list);
+			}
+		}
+
+	public:
+		contraction_hierarchy() noexcept
+		{
+		}
+		// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t) and return non-negative weights.
+		// time complexity:  O(V * witness searches), dominated by the witness searches
+		template<typename graph_t, typename weight_invokable_t>
+		contraction_hierarchy(graph_t const& graph, weight_invokable_t weight_invokable)
+		{
+			struct work_arc_t
+			{
+				vertex_index_t to; // the other end, for in-arcs the source
+				scalar_t weight;
+				vertex_index_t middle;
+			};
+			const std::size_t V = graph.V.size();
+			std::vector<std::vector<work_arc_t>> out(V), in(V);
+
+			// keeps at most one arc per ordered pair, the shortest
+			const auto add_arc = [&out, &in](vertex_index_t from, vertex_index_t to, scalar_t weight, vertex_index_t middle){
+				for(work_arc_t& arc : out[from])
+					if(arc.to == to) {
+						if(!(weight < arc.weight))
+							return;
+						arc.weight = weight;
+						arc.middle = middle;
+						for(work_arc_t& in_arc : in[to])
+							if(in_arc.to == from) {
+								in_arc.weight = weight;
+								in_arc.middle = middle;
+								break;
+							}
+						return;
+					}
+				out[from].push_back({ to, weight, middle });
+				in[to].push_back({ from, weight, middle });
+			};
+			for(std::size_t from = 0; from < V; ++from)
+				for(auto const& edge : graph.V[from].out_edges)
+					if(edge.to != from) {
+						const scalar_t weight = weight_invokable(from, edge);
+						assert(!(weight < scalar_t(0)));
+						add_arc(static_cast<vertex_index_t>(from), static_cast<vertex_index_t>(edge.to), weight, no_middle);
+					}
+
+			std::vector<bool> contracted(V, false);
+			std::vector<std::size_t> contracted_neighbors(V, 0);
+
+			// bounded Dijkstra in the remaining graph, which also avoids the vertex being contracted
+			std::vector<scalar_t> witness_distance(V, inf<scalar_t>);
+			std::vector<vertex_index_t> touched;
+			min_heap<std::pair<scalar_t, vertex_index_t>> queue;
+			const auto witness_search = [&](vertex_index_t source, vertex_index_t excluded, scalar_t const& limit){
+				for(vertex_index_t index : touched)
+					witness_distance[index] = inf<scalar_t>;
+				touched.clear();
+				queue.clear();
+				witness_distance[source] = scalar_t(0);
+				touched.push_back(source);
+				queue.push(scalar_t(0), source);
+				for(std::size_t settled = 0; !queue.empty() && settled < witness_settle_limit;) {
+					const auto [distance, index] = queue.extract_top();
+					if(witness_distance[index] < distance)
+						continue;
+					if(limit < distance)
+						break;
+					++settled;
+					for(work_arc_t const& arc : out[index]) {
+						if(contracted[arc.to] || arc.to == excluded)
+							continue;
+						const scalar_t candidate = distance + arc.weight;
+						if(candidate < witness_distance[arc.to]) {
+							if(witness_distance[arc.to] == inf<scalar_t>)
+								touched.push_back(arc.to);
+							witness_distance[arc.to] = candidate;
+							queue.push(candidate, arc.to);
+						}
+					}
+				}
+			};
+			// returns the number of shortcuts contracting index needs; adds them iff apply
+			const auto shortcuts = [&](vertex_index_t index, bool apply){
+				std::size_t count = 0;
+				for(work_arc_t const& in_arc : in[index]) {
+					const vertex_index_t from = in_arc.to;
+					if(contracted[from])
+						continue;
+					bool any = false;
+					scalar_t limit{};
+					for(work_arc_t const& out_arc : out[index])
+						if(!contracted[out_arc.to] && out_arc.to != from) {
+							limit = any ? std::max(limit, in_arc.weight + out_arc.weight) : in_arc.weight + out_arc.weight;
+							any = true;
+						}
+					if(!any)
+						continue;
+					witness_search(from, index, limit);
+					for(work_arc_t const& out_arc : out[index]) {
+						if(contracted[out_arc.to] || out_arc.to == from)
+							continue;
+						const scalar_t via = in_arc.weight + out_arc.weight;
+						if(!(via < witness_distance[out_arc.to]))
+							continue;
+						++count;
+						if(apply)
+							add_arc(from, out_arc.to, via, index);
+					}
+				}
+				return count;
+			};
+			const auto priority = [&](vertex_index_t index){
+				std::ptrdiff_t removed = 0;
+				for(work_arc_t const& arc : out[index])
+					removed += !contracted[arc.to];
+				for(work_arc_t const& arc : in[index])
+					removed += !contracted[arc.to];
+				return static_cast<std::ptrdiff_t>(shortcuts(index, false)) - removed + static_cast<std::ptrdiff_t>(contracted_neighbors[index]);
+			};
+
+			min_heap<std::pair<std::ptrdiff_t, vertex_index_t>> order;
+			for(std::size_t index = 0; index < V; ++index)
+				order.push(priority(static_cast<vertex_index_t>(index)), static_cast<vertex_index_t>(index));
+
+			m_rank.assign(V, 0);
+			std::vector<std::vector<arc_t>> up(V), down(V);
+			for(vertex_index_t rank = 0; !order.empty();) {
+				const vertex_index_t index = order.extract_top().second;
+				// lazy update: contract only if still no worse than the next candidate
+				const std::ptrdiff_t updated = priority(index);
+				if(!order.empty() && order.top().first < updated) {
+					order.push(updated, index);
+					continue;
+				}
+
+				shortcuts(index, true);
+				for(work_arc_t const& arc : out[index])
+					if(!contracted[arc.to]) {
+						up[index].push_back({ arc.to, arc.weight, arc.middle });
+						++contracted_neighbors[arc.to];
+					}
+				for(work_arc_t const& arc : in[index])
+					if(!contracted[arc.to]) {
+						down[index].push_back({ arc.to, arc.weight, arc.middle });
+						++contracted_neighbors[arc.to];
+					}
+				contracted[index] = true;
+				m_rank[index] = rank++;
+				std::vector<work_arc_t>().swap(out[index]);
+				std::vector<work_arc_t>().swap(in[index]);
+			}
+
+			build_csr(up, m_up_offsets, m_up_arcs);
+			build_csr(down, m_down_offsets, m_down_arcs);
+		}
+		template<typename graph_t>
+		explicit contraction_hierarchy(graph_t const& graph)
+		: contraction_hierarchy(graph, dijkstra_default_weight_invokable<graph_t>())
+		{
+		}
+
+		std::size_t size() const noexcept
+		{
+			return m_rank.size();
+		}
+		// The position of index in the contraction order.
+		vertex_index_t rank(vertex_index_t index) const noexcept
+		{
+			assert(index < size());
+			return m_rank[index];
+		}
+		std::span<arc_t const> up_arcs(vertex_index_t index) const noexcept
+		{
+			assert(index < size());
+			return { m_up_arcs.data() + m_up_offsets[index], m_up_offsets[index + 1] - m_up_offsets[index] };
+		}
+		std::span<arc_t const> down_arcs(vertex_index_t index) const noexcept
+		{
+			assert(index < size());
+			return { m_down_arcs.data() + m_down_offsets[index], m_down_offsets[index + 1] - m_down_offsets[index] };
+		}
+		std::size_t arc_count() const noexcept
+		{
+			return m_up_arcs.size() + m_down_arcs.size();
+		}
+		std::size_t shortcut_count() const noexcept
+		{
+			const auto is_shortcut = [](arc_t const& arc){ return arc.middle != no_middle; };
+			return std::count_if(m_up_arcs.begin(), m_up_arcs.end(), is_shortcut) + std::count_if(m_down_arcs.begin(), m_down_arcs.end(), is_shortcut);
+		}
+
+		// The arc from -> to of the hierarchy or nullptr if there is none.
+		arc_t const* arc(vertex_index_t from, vertex_index_t to) const noexcept
+		{
+			if(rank(from) < rank(to)) {
+				for(arc_t const& arc : up_arcs(from))
+					if(arc.to == to)
+						return &arc;
+			} else {
+				for(arc_t const& arc : down_arcs(to))
+					if(arc.to == from)
+						return &arc;
+			}
+			return nullptr;
+		}
+		// Appends the vertices of the original path of the arc from -> to to path, excluding from.
+		void unpack(vertex_index_t from, vertex_index_t to, std::vector<vertex_index_t>& path) const
+		{
+			std::vector<std::pair<vertex_index_t, vertex_index_t>> stack = { { from, to } };
+			while(!stack.empty()) {
+				const auto [first, second] = stack.back();
+				stack.pop_back();
+				arc_t const* const shortcut = arc(first, second);
+				assert(shortcut != nullptr);
+				const vertex_index_t middle = shortcut->middle;
+				if(middle == no_middle) {
+					path.push_back(second);
+				} else {
+					stack.emplace_back(middle, second);
+					stack.emplace_back(first, middle);
+				}
+			}
+		}
+
+		// Convenience wrappers that allocate a contraction_hierarchy_query per call.
+		[[nodiscard]] scalar_t distance(vertex_index_t source, vertex_index_t target) const;
+		[[nodiscard]] std::pair<scalar_t, std::vector<vertex_index_t>> shortest_path(vertex_index_t source, vertex_index_t target) const;
+	};
+
+	template<typename graph_t, typename weight_invokable_t>
+	contraction_hierarchy(graph_t const&, weight_invokable_t) -> contraction_hierarchy<dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const typename graph_t::out_edge_t>>, vertex_index_type<graph_t>>;
+	template<typename graph_t>
+	contraction_hierarchy(graph_t const&) -> contraction_hierarchy<dijkstra_distance_t<std::invoke_result_t<decltype(dijkstra_default_weight_invokable<graph_t>()), vertex_index_t, const typename graph_t::out_edge_t>>, vertex_index_type<graph_t>>;
+
+	// Answers queries on a contraction_hierarchy with a bidirectional search on the upward arcs.
+	// Keeps its buffers between queries, which only cost time proportional to the searched part of the hierarchy.
+	// Not thread-safe; use one query object per thread.
+	template<typename scalar_t, typename index_t = vertex_index_t>
+	class contraction_hierarchy_query
+	{
+	public:
+		using vertex_index_t = index_t;
+		using hierarchy_t = contraction_hierarchy<scalar_t, index_t>;
+
+	private:
+		struct side_t
+		{
+			search_workspace<vertex_index_t> reached;
+			std::vector<scalar_t> distance;
+			std::vector<vertex_index_t> predecessor;
+			min_heap<std::pair<scalar_t, vertex_index_t>> queue;
+
+			explicit side_t(std::size_t V)
+			: reached(V), distance(V), predecessor(V)
+			{
+			}
+			void start(vertex_index_t index)
+			{
+				reached.reset();
+				queue.clear();
+				reached.set(index);
+				distance[index] = scalar_t(0);
+				predecessor[index] = index;
+				queue.push(scalar_t(0), index);
+			}
+		};
+
+		hierarchy_t const* m_hierarchy;
+		side_t m_forward, m_backward;
+		bool m_found = false;
+		scalar_t m_distance{};
+		vertex_index_t m_meet = 0;
+
+		void run(vertex_index_t source, vertex_index_t target)
+		{
+			assert(source < m_hierarchy->size());
+			assert(target < m_hierarchy->size());
+			m_forward.start(source);
+			m_backward.start(target);
+			m_found = false;
+			m_distance = inf<scalar_t>;
+
+			const auto active = [this](side_t const& side){
+				return !side.queue.empty() && (!m_found || side.queue.top().first < m_distance);
+			};
+			for(;;) {
+				const bool forward_active = active(m_forward), backward_active = active(m_backward);
+				if(!forward_active && !backward_active)
+					break;
+				const bool is_forward = forward_active && (!backward_active || !(m_backward.queue.top().first < m_forward.queue.top().first));
+				side_t& side = is_forward ? m_forward : m_backward;
+				side_t const& other = is_forward ? m_backward : m_forward;
+
+				const auto [distance, index] = side.queue.extract_top();
+				if(side.distance[index] < distance)
+					continue;
+				if(other.reached(index) && (!m_found || distance + other.distance[index] < m_distance)) {
+					m_found = true;
+					m_distance = distance + other.distance[index];
+					m_meet = index;
+				}
+				for(auto const& arc : is_forward ? m_hierarchy->up_arcs(index) : m_hierarchy->down_arcs(index)) {
+					const scalar_t candidate = distance + arc.weight;
+					if(!side.reached(arc.to) || candidate < side.distance[arc.to]) {
+						side.reached.set(arc.to);
+						side.distance[arc.to] = candidate;
+						side.predecessor[arc.to] = index;
+						side.queue.push(candidate, arc.to);
+					}
+				}
+			}
+		}
+
+	public:
+		explicit contraction_hierarchy_query(hierarchy_t const& hierarchy)
+		: m_hierarchy(&hierarchy), m_forward(hierarchy.size()), m_backward(hierarchy.size())
+		{
+		}
+
+		// Returns inf if target is unreachable.
+		[[nodiscard]] scalar_t distance(vertex_index_t source, vertex_index_t target)
+		{
+			run(source, target);
+			return m_distance;
+		}
+		// Return type is (distance, path from source to target) in vertices of the original graph; if target is unreachable, (inf, {}).
+		[[nodiscard]] std::pair<scalar_t, std::vector<vertex_index_t>> shortest_path(vertex_index_t source, vertex_index_t target)
+		{
+			run(source, target);
+			std::pair<scalar_t, std::vector<vertex_index_t>> result(m_distance, {});
+			if(!m_found)
+				return result;
+
+			std::vector<vertex_index_t> hierarchy_path;
+			for(vertex_index_t index = m_meet; index != source; index = m_forward.predecessor[index])
+				hierarchy_path.push_back(index);
+			hierarchy_path.push_back(source);
+			std::reverse(hierarchy_path.begin(), hierarchy_path.end());
+			for(vertex_index_t index = m_meet; index != target;) {
+				index = m_backward.predecessor[index];
+				hierarchy_path.push_back(index);
+			}
+
+			std::vector<vertex_index_t>& path = result.second;
+			path.push_back(source);
+			for(std::size_t i = 1; i < hierarchy_path.size(); ++i)
+				m_hierarchy->unpack(hierarchy_path[i - 1], hierarchy_path[i], path);
+			return result;
+		}
+	};
+
+	template<typename scalar_t, typename index_t>
+	contraction_hierarchy_query(contraction_hierarchy<scalar_t, index_t> const&) -> contraction_hierarchy_query<scalar_t, index_t>;
+
+	template<typename scalar_t, typename index_t>
+	scalar_t contraction_hierarchy<scalar_t, index_t>::distance(vertex_index_t source, vertex_index_t target) const
+	{
+		return contraction_hierarchy_query<scalar_t, index_t>(*this).distance(source, target);
+	}
+	template<typename scalar_t, typename index_t>
+	auto contraction_hierarchy<scalar_t, index_t>::shortest_path(vertex_index_t source, vertex_index_t target) const -> std::pair<scalar_t, std::vector<vertex_index_t>>
+	{
+		return contraction_hierarchy_query<scalar_t, index_t>(*this).shortest_path(source, target);
+	}
+}
+
+#endif // !QUIVER_SEARCH_CONTRACTION_HIERARCHY_HPP_INCLUDED
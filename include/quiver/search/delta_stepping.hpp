@@ -0,0 +1,218 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_DELTA_STEPPING_HPP_INCLUDED
+#define QUIVER_SEARCH_DELTA_STEPPING_HPP_INCLUDED
+
+#include <quiver/search/dijkstra.hpp>
+#include <quiver/adjacency_list.hpp>
+#include <quiver/thread_pool.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <ranges>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <cassert>
+
+namespace quiver
+{
+	namespace detail
+	{
+		template<typename graph_t, typename weight_invokable_t>
+		using delta_stepping_scalar_t = dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const typename graph_t::out_edge_t>>;
+	}
+
+	// Delta-stepping (Meyer and Sanders): the tentative distances are kept in buckets of width delta.
+	// All vertices of the lowest bucket are settled together, relaxing their light edges (weight <= delta)
+	// until the bucket stays empty and their heavy edges once afterwards.
+	// Vertex v is owned by thread v % pool.size(). Threads send relaxation requests to the owners,
+	// which apply them to their vertices only, so the distances need no atomics.
+	// Return type is a map from vertex index to (distance from start, predecessor), like dijkstra_shortest_path,
+	// including the widening of narrow weights to dijkstra_distance_t.
+	// Which of several equally short paths is recorded depends on scheduling.
+	// If delta is not positive, max weight / average out-degree is used.
+	// Weights must not be negative.
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto delta_stepping_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, weight_invokable_t narrow_weight_invokable, detail::delta_stepping_scalar_t<graph_t, weight_invokable_t> delta, thread_pool& pool)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = detail::delta_stepping_scalar_t<graph_t, weight_invokable_t>;
+		using vertex_index_t = vertex_index_type<graph_t>;
+		const auto weight_invokable = detail::widened_weight_invokable<graph_t>(narrow_weight_invokable);
+
+		struct request_t
+		{
+			vertex_index_t to;
+			scalar_t distance;
+			vertex_index_t predecessor;
+		};
+		struct owner_t
+		{
+			std::vector<std::vector<vertex_index_t>> buckets;
+			std::size_t pending = 0; // the number of entries in buckets, including stale ones
+			std::vector<vertex_index_t> frontier;
+			std::vector<vertex_index_t> settled; // removed from the current bucket, their heavy edges are yet to be relaxed
+			scalar_t max_weight{};
+			std::size_t out_edges = 0;
+		};
+
+		constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
+		const std::size_t V = graph.V.size();
+		const std::size_t T = pool.size();
+		std::vector<std::pair<scalar_t, vertex_index_t>> result(V, { inf<scalar_t>, no_predecessor });
+		std::vector<owner_t> owners(T);
+		std::vector<std::vector<std::vector<request_t>>> requests(T, std::vector<std::vector<request_t>>(T)); // [from thread][to owner]
+		std::vector<char> in_settled(V, false);
+
+		pool.run([&](std::size_t thread_index){
+			owner_t& owner = owners[thread_index];
+			for(std::size_t index = thread_index; index < V; index += T)
+				for(out_edge_t const& edge : graph.V[index].out_edges) {
+					const scalar_t weight = weight_invokable(index, edge);
+					assert(!(weight < scalar_t(0)));
+					owner.max_weight = std::max(owner.max_weight, weight);
+					++owner.out_edges;
+				}
+		});
+		scalar_t max_weight{};
+		std::size_t out_edges = 0;
+		for(owner_t const& owner : owners) {
+			max_weight = std::max(max_weight, owner.max_weight);
+			out_edges += owner.out_edges;
+		}
+		if(!(delta > scalar_t(0))) {
+			const std::size_t average_degree = std::max<std::size_t>(V != 0 ? out_edges / V : 0, 1);
+			delta = max_weight / static_cast<scalar_t>(average_degree);
+			if(!(delta > scalar_t(0)))
+				delta = scalar_t(1);
+		}
+		// tentative distances lie within [i * delta, (i + 1) * delta + max_weight] while bucket i is processed
+		const std::size_t bucket_count = static_cast<std::size_t>(max_weight / delta) + 3;
+		for(owner_t& owner : owners)
+			owner.buckets.resize(bucket_count);
+
+		const auto bucket_of = [delta](scalar_t const& distance) noexcept -> std::size_t {
+			return static_cast<std::size_t>(distance / delta);
+		};
+		const auto apply_requests = [&](std::size_t thread_index){
+			owner_t& owner = owners[thread_index];
+			for(std::size_t from = 0; from < T; ++from) {
+				for(request_t const& request : requests[from][thread_index]) {
+					auto& [distance, predecessor] = result[request.to];
+					if(predecessor == no_predecessor || request.distance < distance) {
+						distance = request.distance;
+						predecessor = request.predecessor;
+						owner.buckets[bucket_of(distance) % bucket_count].push_back(request.to);
+						++owner.pending;
+					}
+				}
+				requests[from][thread_index].clear();
+			}
+		};
+		const auto relax = [&](std::size_t thread_index, vertex_index_t index, bool light){
+			const scalar_t distance = result[index].first;
+			for(out_edge_t const& edge : graph.V[index].out_edges) {
+				const scalar_t weight = weight_invokable(index, edge);
+				if(!(weight > delta) == light)
+					requests[thread_index][edge.to % T].push_back({ edge.to, distance + weight, index });
+			}
+		};
+
+		for(vertex_index_t index : start) {
+			assert(index < V);
+			requests[0][index % T].push_back({ index, scalar_t(0), index });
+		}
+		pool.run(apply_requests);
+
+		const auto pending = [&owners]{
+			std::size_t pending = 0;
+			for(owner_t const& owner : owners)
+				pending += owner.pending;
+			return pending;
+		};
+		const auto bucket_empty = [&owners, bucket_count](std::size_t bucket){
+			for(owner_t const& owner : owners)
+				if(!owner.buckets[bucket % bucket_count].empty())
+					return false;
+			return true;
+		};
+		for(std::size_t bucket = 0; pending() != 0; ++bucket) {
+			if(bucket_empty(bucket))
+				continue;
+			do {
+				pool.run([&](std::size_t thread_index){
+					owner_t& owner = owners[thread_index];
+					owner.frontier.swap(owner.buckets[bucket % bucket_count]);
+					owner.pending -= owner.frontier.size();
+					for(vertex_index_t index : owner.frontier) {
+						if(bucket_of(result[index].first) != bucket)
+							continue; // stale, the vertex has moved to a lower bucket since
+						if(!in_settled[index]) {
+							in_settled[index] = true;
+							owner.settled.push_back(index);
+						}
+						relax(thread_index, index, true);
+					}
+					owner.frontier.clear();
+				});
+				pool.run(apply_requests);
+			} while(!bucket_empty(bucket));
+
+			pool.run([&](std::size_t thread_index){
+				owner_t& owner = owners[thread_index];
+				for(vertex_index_t index : owner.settled) {
+					in_settled[index] = false;
+					relax(thread_index, index, false);
+				}
+				owner.settled.clear();
+			});
+			pool.run(apply_requests);
+		}
+		return result;
+	}
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto delta_stepping_shortest_path(graph_t& graph, vertex_index_t start, weight_invokable_t weight_invokable, detail::delta_stepping_scalar_t<graph_t, weight_invokable_t> delta, thread_pool& pool)
+	{
+		return delta_stepping_shortest_path<graph_t, weight_invokable_t>(graph, std::ranges::single_view(start), weight_invokable, delta, pool);
+	}
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto delta_stepping_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, weight_invokable_t weight_invokable, detail::delta_stepping_scalar_t<graph_t, weight_invokable_t> delta)
+	{
+		thread_pool pool;
+		return delta_stepping_shortest_path<graph_t, weight_invokable_t>(graph, start, weight_invokable, delta, pool);
+	}
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto delta_stepping_shortest_path(graph_t& graph, vertex_index_t start, weight_invokable_t weight_invokable, detail::delta_stepping_scalar_t<graph_t, weight_invokable_t> delta)
+	{
+		return delta_stepping_shortest_path<graph_t, weight_invokable_t>(graph, std::ranges::single_view(start), weight_invokable, delta);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto delta_stepping_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, thread_pool& pool)
+	{
+		return delta_stepping_shortest_path(graph, start, dijkstra_default_weight_invokable<graph_t>(), {}, pool);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto delta_stepping_shortest_path(graph_t& graph, vertex_index_t start, thread_pool& pool)
+	{
+		return delta_stepping_shortest_path<graph_t>(graph, std::ranges::single_view(start), pool);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto delta_stepping_shortest_path(graph_t& graph, std::ranges::input_range auto const& start)
+	{
+		thread_pool pool;
+		return delta_stepping_shortest_path<graph_t>(graph, start, pool);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto delta_stepping_shortest_path(graph_t& graph, vertex_index_t start)
+	{
+		return delta_stepping_shortest_path<graph_t>(graph, std::ranges::single_view(start));
+	}
+}
+
+#endif // !QUIVER_SEARCH_DELTA_STEPPING_HPP_INCLUDED
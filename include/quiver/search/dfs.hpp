@@ -9,58 +9,210 @@
 #define QUIVER_SEARCH_DFS_HPP_INCLUDED
 
 #include <quiver/search/visitation_table.hpp>
+#include <quiver/search/search_workspace.hpp>
 #include <quiver/adjacency_list.hpp>
 #include <quiver/util.hpp>
+#include <type_traits>
+#include <utility>
 #include <ranges>
 #include <vector>
-#include <stack>
 #include <cassert>
 
 namespace quiver
 {
-	// visitor shall have the signature bool(vertex_index_t).
-	// If visitor returns true, exit the search and return true.
-	// Returns false if no visitation returned true.
-	template<typename graph_t, typename visitor_t>
-	bool dfs(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor)
+	namespace detail
 	{
-		using vertex_t = copy_const<graph_t, typename graph_t::vertex_t>;
-		// using out_edge_t = typename graph_t::out_edge_t;
+		// A vertex on the current path of a depth first search, with the next of its out-edges to examine.
+		template<typename index_t, typename edge_iterator_t>
+		struct dfs_frame_t
+		{
+			index_t index;
+			edge_iterator_t next;
 
-		std::vector<bool> enqueued(graph.V.size(), false);
-		std::stack<vertex_index_t> neighbors;
-		for(vertex_index_t index : start) {
-			assert(index < graph.V.size());
-			enqueued[index] = true;
-			neighbors.push(index);
-		}
-		do {
-			vertex_index_t index = neighbors.top();
-			assert(enqueued[index]);
-			vertex_t& vertex = graph.V[index];
+			template<typename graph_t>
+			[[nodiscard]] static dfs_frame_t first(graph_t& graph, index_t index)
+			{
+				return { index, std::ranges::begin(graph.V[index].out_edges) };
+			}
+			template<typename graph_t>
+			[[nodiscard]] bool done(graph_t& graph) const
+			{
+				return next == std::ranges::end(graph.V[index].out_edges);
+			}
+			template<typename graph_t>
+			[[nodiscard]] auto& advance(graph_t& graph)
+			{
+				(void)graph; // -Wunused-parameter
+				return *next++;
+			}
+		};
+		template<typename graph_t>
+		using dfs_frame_type = dfs_frame_t<vertex_index_type<graph_t>, decltype(std::ranges::begin(std::declval<copy_const<graph_t, typename graph_t::vertex_t>&>().out_edges))>;
 
-			if(visitor(index))
-				return true;
+		// Same as dfs_frame_t, with the next out-edge as an offset of the width of a vertex index instead of an iterator,
+		// which halves the frame for 32 bit indices. out_edges shall be a sized random access range.
+		template<typename index_t>
+		struct dfs_offset_frame_t
+		{
+			index_t index;
+			index_t next;
 
-			neighbors.pop();
+			template<typename graph_t>
+			[[nodiscard]] static dfs_offset_frame_t first(graph_t&, index_t index) noexcept
+			{
+				return { index, 0 };
+			}
+			template<typename graph_t>
+			[[nodiscard]] bool done(graph_t& graph) const
 			{
-				// reverse here so that first inserted is first visited
-				const auto begin = vertex.out_edges.rbegin();
-				const auto end = vertex.out_edges.rend();
-				for(auto iter = begin; iter != end; ++iter)
-					if(!enqueued[iter->to]) {
-						neighbors.push(iter->to);
-						enqueued[iter->to] = true;
+				return next == std::ranges::size(graph.V[index].out_edges);
+			}
+			template<typename graph_t>
+			[[nodiscard]] auto& advance(graph_t& graph)
+			{
+				return std::ranges::begin(graph.V[index].out_edges)[next++];
+			}
+		};
+		// dfs_offset_frame_t where out_edges allows it, dfs_frame_t otherwise.
+		template<typename graph_t>
+		using dfs_compact_frame_type = std::conditional_t<
+			std::ranges::random_access_range<decltype(std::declval<copy_const<graph_t, typename graph_t::vertex_t>&>().out_edges)> && std::ranges::sized_range<decltype(std::declval<copy_const<graph_t, typename graph_t::vertex_t>&>().out_edges)>,
+			dfs_offset_frame_t<vertex_index_type<graph_t>>,
+			dfs_frame_type<graph_t>
+		>;
+
+		// Events return bool like the visitors of the other searches, or void if they never exit.
+		template<typename event_t>
+		constexpr bool dfs_event(event_t&& event)
+		{
+			if constexpr(std::is_void_v<std::invoke_result_t<event_t>>) {
+				event();
+				return false;
+			} else {
+				return event();
+			}
+		}
+
+		// discovered shall provide set(vertex_index_t) and bool(vertex_index_t) like visitation_table_t.
+		// frame_t is dfs_frame_type<graph_t> or dfs_compact_frame_type<graph_t>.
+		template<typename graph_t, typename visitor_t, typename discovered_t, typename frame_t>
+		bool basic_dfs_events(graph_t& graph, std::ranges::input_range auto const& start, visitor_t& visitor, discovered_t& discovered, std::vector<frame_t>& stack)
+		{
+			using out_edge_t = typename graph_t::out_edge_t;
+			using vertex_index_t = vertex_index_type<graph_t>;
+
+			const auto discover = [&graph, &visitor, &discovered, &stack](vertex_index_t index, vertex_index_t parent) -> bool {
+				discovered.set(index);
+				if constexpr(requires { visitor.discover_vertex(index, parent); }) {
+					if(dfs_event([&]{ return visitor.discover_vertex(index, parent); }))
+						return true;
+				}
+				stack.push_back(frame_t::first(graph, index));
+				return false;
+			};
+
+			stack.clear();
+			for(vertex_index_t root : start) {
+				assert(root < graph.V.size());
+				if(discovered(root))
+					continue;
+				if(discover(root, root))
+					return true;
+				while(!stack.empty()) {
+					auto& frame = stack.back();
+					const vertex_index_t index = frame.index;
+					if(!frame.done(graph)) {
+						// frame may dangle once the target is pushed
+						out_edge_t const& edge = frame.advance(graph);
+						if constexpr(requires { visitor.examine_edge(index, edge); }) {
+							if(dfs_event([&]{ return visitor.examine_edge(index, edge); }))
+								return true;
+						}
+						if(!discovered(edge.to) && discover(edge.to, index))
+							return true;
+					} else {
+						stack.pop_back();
+						const vertex_index_t parent = stack.empty() ? index : stack.back().index;
+						if constexpr(requires { visitor.finish_vertex(index, parent); }) {
+							if(dfs_event([&]{ return visitor.finish_vertex(index, parent); }))
+								return true;
+						}
 					}
+				}
 			}
-		} while(!neighbors.empty());
-		return false;
+			return false;
+		}
+
+		template<typename visitor_t>
+		struct dfs_preorder_visitor_t
+		{
+			visitor_t& visitor;
+
+			bool discover_vertex(vertex_index_t index, vertex_index_t parent)
+			{
+				(void)parent; // -Wunused-parameter
+				return visitor(index);
+			}
+		};
+	}
+
+	// Depth first search reporting events to visitor, which may define any of the members
+	//   discover_vertex(vertex_index_t index, vertex_index_t parent) when index is reached first, with parent == index for roots,
+	//   examine_edge(vertex_index_t from, out_edge_t const& edge) for every out-edge of a discovered vertex, before its target may be discovered,
+	//   finish_vertex(vertex_index_t index, vertex_index_t parent) once all out-edges of index are examined and its descendants finished.
+	// If an event returns true, exit the search and return true; events may also return void.
+	// Returns false if no event returned true.
+	// Every vertex of start that has not been discovered yet is the root of a new tree.
+	// Instead of recursing, the search keeps one (vertex, next out-edge) frame per vertex on the current path, so it needs O(V) memory.
+	template<typename graph_t, typename visitor_t>
+	bool dfs_events(graph_t& graph, std::ranges::input_range auto const& start, visitor_t&& visitor)
+	{
+		visitation_table_t discovered(graph);
+		std::vector<detail::dfs_frame_type<graph_t>> stack;
+		return detail::basic_dfs_events(graph, start, visitor, discovered, stack);
+	}
+	template<typename graph_t, typename visitor_t>
+	bool dfs_events(graph_t& graph, vertex_index_t start, visitor_t&& visitor)
+	{
+		return dfs_events(graph, std::ranges::single_view(start), visitor);
+	}
+	// Same as above, but reuses the marks and the stack of workspace instead of allocating them.
+	template<typename graph_t, typename visitor_t, typename index_t>
+	bool dfs_events(graph_t& graph, std::ranges::input_range auto const& start, visitor_t&& visitor, search_workspace<index_t>& workspace)
+	{
+		workspace.reset(graph.V.size());
+		return detail::basic_dfs_events(graph, start, visitor, workspace, workspace.template buffer<std::vector<detail::dfs_frame_type<graph_t>>>());
+	}
+	template<typename graph_t, typename visitor_t, typename index_t>
+	bool dfs_events(graph_t& graph, vertex_index_t start, visitor_t&& visitor, search_workspace<index_t>& workspace)
+	{
+		return dfs_events(graph, std::ranges::single_view(start), visitor, workspace);
+	}
+
+	// visitor shall have the signature bool(vertex_index_t) and is invoked in preorder.
+	// If visitor returns true, exit the search and return true.
+	// Returns false if no visitation returned true.
+	template<typename graph_t, typename visitor_t>
+	bool dfs(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor)
+	{
+		return dfs_events(graph, start, detail::dfs_preorder_visitor_t<visitor_t>{ visitor });
 	}
 	template<typename graph_t, typename visitor_t>
 	bool dfs(graph_t& graph, vertex_index_t start, visitor_t visitor)
 	{
 		return dfs<graph_t, visitor_t>(graph, std::ranges::single_view(start), visitor);
 	}
+	// Same as above, but reuses the marks and the stack of workspace instead of allocating them.
+	template<typename graph_t, typename visitor_t, typename index_t>
+	bool dfs(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<index_t>& workspace)
+	{
+		return dfs_events(graph, start, detail::dfs_preorder_visitor_t<visitor_t>{ visitor }, workspace);
+	}
+	template<typename graph_t, typename visitor_t, typename index_t>
+	bool dfs(graph_t& graph, vertex_index_t start, visitor_t visitor, search_workspace<index_t>& workspace)
+	{
+		return dfs(graph, std::ranges::single_view(start), visitor, workspace);
+	}
 }
 
 #endif // !QUIVER_SEARCH_DFS_HPP_INCLUDED
@@ -9,18 +9,23 @@
 #define QUIVER_SEARCH_DIJKSTRA_HPP_INCLUDED
 
 #include <quiver/search/visitation_table.hpp>
+#include <quiver/search/search_workspace.hpp>
+#include <quiver/search/semiring.hpp>
 #include <quiver/adjacency_list.hpp>
 #include <quiver/heaps.hpp>
 #include <quiver/util.hpp>
 #include <type_traits>
+#include <algorithm>
 #include <utility>
 #include <cassert>
 #include <ranges>
+#include <vector>
+#include <tuple>
+#include <limits>
+#include <cstdint>
 
 namespace quiver
 {
-	// TODO: Thus far, I've only implemented the "always insert" variant of Dijkstra. I shall also implement the "decrease key" variant.
-
 	template<typename graph_t>
 	[[nodiscard]] constexpr auto dijkstra_default_weight_invokable() noexcept
 	{
@@ -31,20 +36,70 @@ namespace quiver
 		};
 	}
 
+	// The distance type of dial_shortest_path, wide enough that sums of narrow weights do not overflow.
+	using dial_distance_t = std::uint64_t;
+
+	// Whether weights of type scalar_t are narrow enough for Dial's algorithm, whose distances are dial_distance_t.
+	template<typename scalar_t>
+	inline constexpr bool is_dial_weight_v = std::is_unsigned_v<scalar_t> && !std::is_same_v<scalar_t, bool> && std::numeric_limits<scalar_t>::max() <= std::numeric_limits<std::uint16_t>::max();
+
+	// The distance type of the dijkstra and dijkstra_shortest_path overloads for weights of type scalar_t, whichever heap they use:
+	// narrow weights are summed in dial_distance_t, so that long paths do not wrap around.
+	template<typename scalar_t>
+	using dijkstra_distance_t = std::conditional_t<is_dial_weight_v<scalar_t>, dial_distance_t, scalar_t>;
+
+	// The heap of dijkstra and dijkstra_shortest_path unless one is requested explicitly:
+	// the dense dijkstra_shortest_path runs Dial's algorithm for is_dial_weight_v weights, everything else binary_heap.
+	template<typename T>
+	class default_heap;
+
 	namespace detail
 	{
-		template<typename out_edge_t, typename scalar_t, template<typename, typename, typename> typename... additional_t>
-		struct dijkstra_queue_entry_t : public additional_t<out_edge_t, scalar_t, dijkstra_queue_entry_t<out_edge_t, scalar_t, additional_t...>>...
+		template<template<typename> typename heap_t>
+		struct resolve_heap
+		{
+			template<typename T>
+			using templ = heap_t<T>;
+		};
+		template<>
+		struct resolve_heap<default_heap>
+		{
+			template<typename T>
+			using templ = binary_heap<T>;
+		};
+		template<template<typename> typename heap_t>
+		inline constexpr bool is_default_heap_v = false;
+		template<>
+		inline constexpr bool is_default_heap_v<default_heap> = true;
+
+		// Returns weight_invokable with its narrow weights converted to dial_distance_t, see dijkstra_distance_t.
+		template<typename graph_t, typename weight_invokable_t>
+		[[nodiscard]] constexpr auto widened_weight_invokable(weight_invokable_t weight_invokable) noexcept
+		{
+			if constexpr(is_dial_weight_v<std::invoke_result_t<weight_invokable_t, vertex_index_t, const typename graph_t::out_edge_t>>)
+				return [weight_invokable](vertex_index_t index, auto const& out_edge) -> dial_distance_t {
+					return weight_invokable(index, out_edge);
+				};
+			else
+				return weight_invokable;
+		}
+		template<typename graph_t, typename weight_invokable_t>
+		using widened_weight_invokable_t = decltype(widened_weight_invokable<graph_t>(std::declval<weight_invokable_t>()));
+
+		template<typename out_edge_t, typename scalar_t, template<typename> typename semiring_t, template<typename, typename, typename> typename... additional_t>
+		struct dijkstra_queue_entry_t : public additional_t<out_edge_t, scalar_t, dijkstra_queue_entry_t<out_edge_t, scalar_t, semiring_t, additional_t...>>...
 		{
+			using vertex_index_t = typename out_edge_t::vertex_index_t;
+			using semiring_type = semiring_t<scalar_t>;
 			vertex_index_t index;
 			scalar_t distance;
 
 			[[nodiscard]] constexpr dijkstra_queue_entry_t(vertex_index_t index)
-			: additional_t<out_edge_t, scalar_t, dijkstra_queue_entry_t>(std::as_const(index))..., index(index), distance(0)
+			: additional_t<out_edge_t, scalar_t, dijkstra_queue_entry_t>(std::as_const(index))..., index(index), distance(semiring_type::one())
 			{
 			}
 			[[nodiscard]] constexpr dijkstra_queue_entry_t(vertex_index_t index, scalar_t&& distance, out_edge_t const& edge, dijkstra_queue_entry_t&& previous)
-			: additional_t<out_edge_t, scalar_t, dijkstra_queue_entry_t>(std::as_const(index), std::as_const(distance), edge, std::as_const(previous))..., index(index), distance(std::move(previous.distance) + std::move(distance))
+			: additional_t<out_edge_t, scalar_t, dijkstra_queue_entry_t>(std::as_const(index), std::as_const(distance), edge, std::as_const(previous))..., index(index), distance(semiring_type::extend(std::move(previous.distance), std::move(distance)))
 			{
 			}
 
@@ -54,22 +109,44 @@ namespace quiver
 				return invocable(index, distance, this->additional_t<out_edge_t, scalar_t, dijkstra_queue_entry_t>::get()...);
 			}
 		};
-		template<typename out_edge_t, typename scalar_t, template<typename, typename, typename> typename... additional_t>
-		[[nodiscard]] constexpr bool operator<(dijkstra_queue_entry_t<out_edge_t, scalar_t, additional_t...> const& lhs, dijkstra_queue_entry_t<out_edge_t, scalar_t, additional_t...> const& rhs)
+		// The heaps are min-heaps, so the better distance is the smaller entry.
+		template<typename out_edge_t, typename scalar_t, template<typename> typename semiring_t, template<typename, typename, typename> typename... additional_t>
+		[[nodiscard]] constexpr bool operator<(dijkstra_queue_entry_t<out_edge_t, scalar_t, semiring_t, additional_t...> const& lhs, dijkstra_queue_entry_t<out_edge_t, scalar_t, semiring_t, additional_t...> const& rhs)
 		{
-			return lhs.distance < rhs.distance;
+			return semiring_t<scalar_t>::better(lhs.distance, rhs.distance);
 		}
 
-		template<template<typename, typename, typename> typename... additional_t>
-		struct bind_dijkstra_queue_entry_t
+	}
+
+	// Lets radix_heap order Dijkstra queue entries by their integral distance.
+	template<typename out_edge_t, typename scalar_t, template<typename> typename semiring_t, template<typename, typename, typename> typename... additional_t>
+	struct radix_heap_key<detail::dijkstra_queue_entry_t<out_edge_t, scalar_t, semiring_t, additional_t...>>
+	{
+		static_assert(std::is_same_v<semiring_t<scalar_t>, min_plus_semiring<scalar_t>>, "radix_heap needs increasing keys, which only min_plus_semiring provides");
+
+		static constexpr scalar_t get(detail::dijkstra_queue_entry_t<out_edge_t, scalar_t, semiring_t, additional_t...> const& entry) noexcept
+		{
+			return entry.distance;
+		}
+	};
+
+	namespace detail
+	{
+		template<template<typename> typename semiring_t, template<typename, typename, typename> typename... additional_t>
+		struct bind_semiring_queue_entry_t
 		{
 			template<typename out_edge_t, typename scalar_t>
-			using templ = dijkstra_queue_entry_t<out_edge_t, scalar_t, additional_t...>;
+			using templ = dijkstra_queue_entry_t<out_edge_t, scalar_t, semiring_t, additional_t...>;
+		};
+		template<template<typename, typename, typename> typename... additional_t>
+		struct bind_dijkstra_queue_entry_t : bind_semiring_queue_entry_t<min_plus_semiring, additional_t...>
+		{
 		};
 
 		template<typename out_edge_t, typename scalar_t, typename dijkstra_queue_entry_t>
 		struct dijkstra_predecessor_t
 		{
+			using vertex_index_t = typename out_edge_t::vertex_index_t;
 			vertex_index_t predecessor;
 
 			[[nodiscard]] constexpr dijkstra_predecessor_t(vertex_index_t index) noexcept
@@ -90,22 +167,28 @@ namespace quiver
 			}
 		};
 
-		// TODO: let the caller choose the heap data structure
+		// heap_t<queue_entry_t> shall be a min-heap ordered by distance providing
+		// clear(), empty(), push(args...), top(), pop() and extract_top() like binary_heap.
+		// A monotone heap such as radix_heap suffices, since keys are pushed in non-decreasing order of the last extracted one.
 
-		template<template<typename, typename> typename basic_queue_entry_t, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
-		bool basic_dijkstra(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
+		template<template<typename, typename> typename basic_queue_entry_t, typename graph_t, typename weight_invokable_t>
+		using dijkstra_queue_entry_type = basic_queue_entry_t<typename graph_t::out_edge_t, std::invoke_result_t<weight_invokable_t, vertex_index_t, const typename graph_t::out_edge_t>>;
+
+		template<template<typename> typename heap_t, template<typename, typename> typename basic_queue_entry_t, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+		bool basic_dijkstra(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable, heap_t<dijkstra_queue_entry_type<basic_queue_entry_t, graph_t, weight_invokable_t>>& queue)
 		{
 			using out_edge_t = typename graph_t::out_edge_t;
 			using scalar_t = std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>;
 			using queue_entry_t = basic_queue_entry_t<out_edge_t, scalar_t>;
+			using semiring_t = typename queue_entry_t::semiring_type;
 
-			binary_heap<queue_entry_t> queue;
+			queue.clear();
 			for(vertex_index_t index : start) {
 				assert(index < graph.V.size());
 				queue.push(index);
 			}
 
-			do {
+			while(!queue.empty()) {
 				// The reason we don't already .extract_top here is because it
 				// causes unnecessary workload in case visitor returns true.
 				queue_entry_t const& top = queue.top();
@@ -120,107 +203,611 @@ namespace quiver
 				for(out_edge_t const& edge : graph.V[extracted.index].out_edges)
 					if(!has_been_visited(edge.to)) {
 						scalar_t&& edge_weight = weight_invokable(std::as_const(extracted.index), edge);
-						assert(std::as_const(extracted.distance) + std::as_const(edge_weight) >= std::as_const(extracted.distance));
+						assert(!semiring_t::better(semiring_t::extend(std::as_const(extracted.distance), std::as_const(edge_weight)), std::as_const(extracted.distance)));
 						queue.push(edge.to, std::move(edge_weight), edge, std::move(extracted));
 					}
-			} while(!queue.empty());
+			}
 			return false;
 		}
+		template<template<typename> typename heap_t, template<typename, typename> typename basic_queue_entry_t, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+		bool basic_dijkstra(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
+		{
+			heap_t<dijkstra_queue_entry_type<basic_queue_entry_t, graph_t, weight_invokable_t>> queue;
+			return basic_dijkstra<heap_t, basic_queue_entry_t, graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, start, visitor, has_been_visited, weight_invokable, queue);
+		}
+		// The visitor is hooked into workspace, which doubles as has_been_visited.
+		template<template<typename> typename heap_t, template<typename, typename> typename basic_queue_entry_t, typename graph_t, typename visitor_t, typename index_t, typename weight_invokable_t>
+		bool basic_dijkstra(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable)
+		{
+			using queue_t = heap_t<dijkstra_queue_entry_type<basic_queue_entry_t, graph_t, weight_invokable_t>>;
+			workspace.reset(graph.V.size());
+			auto hooked_visitor = workspace.hook_visitor(visitor);
+			return basic_dijkstra<heap_t, basic_queue_entry_t, graph_t, decltype(hooked_visitor), search_workspace<index_t> const&, weight_invokable_t>(graph, start, hooked_visitor, workspace, weight_invokable, workspace.template buffer<queue_t>());
+		}
 	}
 
-	// visitor shall have the signature bool(vertex_index_t, scalar_t).
+	// visitor shall have the signature bool(vertex_index_t, dijkstra_distance_t<scalar_t>).
 	// If visitor returns true, exit the search and return true.
 	// Returns false if no visitation returned true.
 	// has_been_visited shall have the signature bool(vertex_index_t)
 	// and shall return true iff the vertex has been visited by visitor.
 	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t).
-	template<typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
 	bool dijkstra(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
 	{
-		return detail::basic_dijkstra<detail::bind_dijkstra_queue_entry_t<>::templ, graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, start, visitor, has_been_visited, weight_invokable);
+		using widened_t = detail::widened_weight_invokable_t<graph_t, weight_invokable_t>;
+		return detail::basic_dijkstra<detail::resolve_heap<heap_t>::template templ, detail::bind_dijkstra_queue_entry_t<>::templ, graph_t, visitor_t, has_been_visited_t, widened_t>(graph, start, visitor, has_been_visited, detail::widened_weight_invokable<graph_t>(weight_invokable));
 	}
-	template<typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
 	bool dijkstra(graph_t& graph, vertex_index_t start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
 	{
-		return dijkstra<graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, std::ranges::single_view(start), visitor, has_been_visited, weight_invokable);
+		return dijkstra<heap_t, graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, std::ranges::single_view(start), visitor, has_been_visited, weight_invokable);
 	}
-	template<typename graph_t, typename visitor_t, visited_predicate has_been_visited_t>
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t>
 	bool dijkstra(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited)
 	{
-		return dijkstra<graph_t, visitor_t, has_been_visited_t>(graph, start, visitor, has_been_visited, dijkstra_default_weight_invokable<graph_t>());
+		return dijkstra<heap_t, graph_t, visitor_t, has_been_visited_t>(graph, start, visitor, has_been_visited, dijkstra_default_weight_invokable<graph_t>());
 	}
-	template<typename graph_t, typename visitor_t, visited_predicate has_been_visited_t>
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t>
 	bool dijkstra(graph_t& graph, vertex_index_t start, visitor_t visitor, has_been_visited_t has_been_visited)
 	{
-		return dijkstra<graph_t, visitor_t, has_been_visited_t>(graph, std::ranges::single_view(start), visitor, has_been_visited);
+		return dijkstra<heap_t, graph_t, visitor_t, has_been_visited_t>(graph, std::ranges::single_view(start), visitor, has_been_visited);
 	}
-	template<typename graph_t, typename visitor_t>
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename visitor_t>
 	bool dijkstra(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor)
 	{
 		visitation_table_t visitation_table(graph);
-		return dijkstra<graph_t, decltype(visitation_table.hook_visitor(visitor)), visitation_table_t&>(graph, start, visitation_table.hook_visitor(visitor), visitation_table);
+		return dijkstra<heap_t, graph_t, decltype(visitation_table.hook_visitor(visitor)), visitation_table_t&>(graph, start, visitation_table.hook_visitor(visitor), visitation_table);
 	}
-	template<typename graph_t, typename visitor_t>
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename visitor_t>
 	bool dijkstra(graph_t& graph, vertex_index_t start, visitor_t visitor)
 	{
-		return dijkstra<graph_t, visitor_t>(graph, std::ranges::single_view(start), visitor);
+		return dijkstra<heap_t, graph_t, visitor_t>(graph, std::ranges::single_view(start), visitor);
+	}
+	// Same as above, but workspace takes the place of has_been_visited and keeps the heap allocated between calls.
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename visitor_t, typename index_t, typename weight_invokable_t>
+	bool dijkstra(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		return detail::basic_dijkstra<detail::resolve_heap<heap_t>::template templ, detail::bind_dijkstra_queue_entry_t<>::templ>(graph, start, visitor, workspace, detail::widened_weight_invokable<graph_t>(weight_invokable));
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename visitor_t, typename index_t, typename weight_invokable_t>
+	bool dijkstra(graph_t& graph, vertex_index_t start, visitor_t visitor, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		return dijkstra<heap_t>(graph, std::ranges::single_view(start), visitor, workspace, weight_invokable);
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename visitor_t, typename index_t>
+	bool dijkstra(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<index_t>& workspace)
+	{
+		return dijkstra<heap_t>(graph, start, visitor, workspace, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename visitor_t, typename index_t>
+	bool dijkstra(graph_t& graph, vertex_index_t start, visitor_t visitor, search_workspace<index_t>& workspace)
+	{
+		return dijkstra<heap_t>(graph, std::ranges::single_view(start), visitor, workspace);
 	}
 
-	// visitor shall have the signature bool(vertex_index_t, scalar_t, vertex_index_t).
+	// visitor shall have the signature bool(vertex_index_t, dijkstra_distance_t<scalar_t>, vertex_index_t).
 	// If visitor returns true, exit the search and return true.
 	// Returns false if no visitation returned true.
 	// has_been_visited shall have the signature bool(vertex_index_t)
 	// and shall return true iff the vertex has been visited by visitor.
 	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t).
-	template<typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
 	bool dijkstra_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
 	{
-		return detail::basic_dijkstra<detail::bind_dijkstra_queue_entry_t<detail::dijkstra_predecessor_t>::templ, graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, start, visitor, has_been_visited, weight_invokable);
+		using widened_t = detail::widened_weight_invokable_t<graph_t, weight_invokable_t>;
+		return detail::basic_dijkstra<detail::resolve_heap<heap_t>::template templ, detail::bind_dijkstra_queue_entry_t<detail::dijkstra_predecessor_t>::templ, graph_t, visitor_t, has_been_visited_t, widened_t>(graph, start, visitor, has_been_visited, detail::widened_weight_invokable<graph_t>(weight_invokable));
 	}
-	template<typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
 	bool dijkstra_shortest_path(graph_t& graph, vertex_index_t start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
 	{
-		return dijkstra_shortest_path<graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, std::ranges::single_view(start), visitor, has_been_visited, weight_invokable);
+		return dijkstra_shortest_path<heap_t, graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, std::ranges::single_view(start), visitor, has_been_visited, weight_invokable);
 	}
-	// Return type is a map from vertex index to (distance from start, predecessor)
+
+	// Dijkstra over the path algebra semiring_t<scalar_t> instead of (min, +), see semiring.hpp.
+	// Every semiring is a separate instantiation, so the loop is as tight as the one of dijkstra_shortest_path.
+	// visitor shall have the signature bool(vertex_index_t, scalar_t, vertex_index_t).
+	// If visitor returns true, exit the search and return true.
+	// Returns false if no visitation returned true.
+	// has_been_visited shall have the signature bool(vertex_index_t)
+	// and shall return true iff the vertex has been visited by visitor.
+	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t).
+	template<template<typename> typename semiring_t, template<typename> typename heap_t = binary_heap, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+	bool semiring_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
+	{
+		return detail::basic_dijkstra<heap_t, detail::bind_semiring_queue_entry_t<semiring_t, detail::dijkstra_predecessor_t>::template templ, graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, start, visitor, has_been_visited, weight_invokable);
+	}
+	template<template<typename> typename semiring_t, template<typename> typename heap_t = binary_heap, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+	bool semiring_shortest_path(graph_t& graph, vertex_index_t start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
+	{
+		return semiring_shortest_path<semiring_t, heap_t, graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, std::ranges::single_view(start), visitor, has_been_visited, weight_invokable);
+	}
+	namespace detail
+	{
+		// Runs search(visitor, has_been_visited) into a map from vertex index to (distance, predecessor),
+		// where the vertices that visitor was not called for keep the distance zero.
+		template<typename graph_t, typename scalar_t, typename search_t>
+		[[nodiscard]] auto dense_shortest_path(graph_t& graph, scalar_t const& zero, search_t search)
+		{
+			using vertex_index_t = vertex_index_type<graph_t>;
+
+			constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
+			std::vector<std::pair<scalar_t, vertex_index_t>> result(graph.V.size(), { zero, no_predecessor });
+			auto visitor = [&result](vertex_index_t vertex, scalar_t distance, vertex_index_t predecessor) -> bool {
+				result[vertex] = { distance, predecessor };
+				return false;
+			};
+			auto has_been_visited = [&result](vertex_index_t index){
+				return result[index].second != no_predecessor;
+			};
+			search(std::move(visitor), std::move(has_been_visited));
+			return result;
+		}
+	}
+
+	// Return type is a map from vertex index to (distance from start, predecessor),
+	// where unreachable vertices have the distance semiring_t<scalar_t>::zero().
+	template<template<typename> typename semiring_t, template<typename> typename heap_t = binary_heap, typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto semiring_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, weight_invokable_t weight_invokable)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>;
+
+		return detail::dense_shortest_path(graph, semiring_t<scalar_t>::zero(), [&](auto visitor, auto has_been_visited){
+			semiring_shortest_path<semiring_t, heap_t, graph_t, decltype(visitor), decltype(has_been_visited), weight_invokable_t>(graph, start, std::move(visitor), std::move(has_been_visited), weight_invokable);
+		});
+	}
+	template<template<typename> typename semiring_t, template<typename> typename heap_t = binary_heap, typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto semiring_shortest_path(graph_t& graph, vertex_index_t start, weight_invokable_t weight_invokable)
+	{
+		return semiring_shortest_path<semiring_t, heap_t, graph_t, weight_invokable_t>(graph, std::ranges::single_view(start), weight_invokable);
+	}
+	template<template<typename> typename semiring_t, template<typename> typename heap_t = binary_heap, typename graph_t>
+	[[nodiscard]] auto semiring_shortest_path(graph_t& graph, std::ranges::input_range auto const& start)
+	{
+		return semiring_shortest_path<semiring_t, heap_t>(graph, start, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<template<typename> typename semiring_t, template<typename> typename heap_t = binary_heap, typename graph_t>
+	[[nodiscard]] auto semiring_shortest_path(graph_t& graph, vertex_index_t start)
+	{
+		return semiring_shortest_path<semiring_t, heap_t, graph_t>(graph, std::ranges::single_view(start));
+	}
+
+	// Widest (maximum bottleneck) paths: the distance of a vertex is the largest capacity
+	// over all paths from start, where the capacity of a path is its smallest weight.
+	// Return type is a map from vertex index to (capacity, predecessor), with inf for start and lowest() for unreachable vertices.
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto widest_path(graph_t& graph, std::ranges::input_range auto const& start, weight_invokable_t weight_invokable)
+	{
+		return semiring_shortest_path<max_min_semiring, heap_t>(graph, start, weight_invokable);
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto widest_path(graph_t& graph, vertex_index_t start, weight_invokable_t weight_invokable)
+	{
+		return semiring_shortest_path<max_min_semiring, heap_t>(graph, start, weight_invokable);
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t>
+	[[nodiscard]] auto widest_path(graph_t& graph, std::ranges::input_range auto const& start)
+	{
+		return semiring_shortest_path<max_min_semiring, heap_t>(graph, start);
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t>
+	[[nodiscard]] auto widest_path(graph_t& graph, vertex_index_t start)
+	{
+		return semiring_shortest_path<max_min_semiring, heap_t>(graph, start);
+	}
+
+	// Most reliable paths: the weights are probabilities in [0, 1] and the distance of a vertex is
+	// the largest product of the weights over all paths from start.
+	// Return type is a map from vertex index to (probability, predecessor), with 0 for unreachable vertices.
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto most_reliable_path(graph_t& graph, std::ranges::input_range auto const& start, weight_invokable_t weight_invokable)
+	{
+		return semiring_shortest_path<max_times_semiring, heap_t>(graph, start, weight_invokable);
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto most_reliable_path(graph_t& graph, vertex_index_t start, weight_invokable_t weight_invokable)
+	{
+		return semiring_shortest_path<max_times_semiring, heap_t>(graph, start, weight_invokable);
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t>
+	[[nodiscard]] auto most_reliable_path(graph_t& graph, std::ranges::input_range auto const& start)
+	{
+		return semiring_shortest_path<max_times_semiring, heap_t>(graph, start);
+	}
+	template<template<typename> typename heap_t = binary_heap, typename graph_t>
+	[[nodiscard]] auto most_reliable_path(graph_t& graph, vertex_index_t start)
+	{
+		return semiring_shortest_path<max_times_semiring, heap_t>(graph, start);
+	}
+
 	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto dial_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, weight_invokable_t weight_invokable);
+
+	// Return type is a map from vertex index to (distance from start, predecessor), the distances dijkstra_distance_t.
+	// If is_dial_weight_v<scalar_t> and no heap was requested explicitly, this is dial_shortest_path.
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename weight_invokable_t>
 	[[nodiscard]] auto dijkstra_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, weight_invokable_t weight_invokable)
 	{
 		using out_edge_t = typename graph_t::out_edge_t;
 		using scalar_t = std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>;
 
-		constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
-		std::vector<std::pair<scalar_t, vertex_index_t>> result(graph.V.size(), { inf<scalar_t>, no_predecessor });
+		if constexpr(is_dial_weight_v<scalar_t> && detail::is_default_heap_v<heap_t>) {
+			// a bucket queue beats a heap for narrow weights
+			return dial_shortest_path(graph, start, weight_invokable);
+		} else {
+			return semiring_shortest_path<min_plus_semiring, detail::resolve_heap<heap_t>::template templ>(graph, start, detail::widened_weight_invokable<graph_t>(weight_invokable));
+		}
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto dijkstra_shortest_path(graph_t& graph, vertex_index_t start, weight_invokable_t weight_invokable)
+	{
+		return dijkstra_shortest_path<heap_t, graph_t, weight_invokable_t>(graph, std::ranges::single_view(start), weight_invokable);
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t>
+	[[nodiscard]] auto dijkstra_shortest_path(graph_t& graph, std::ranges::input_range auto const& start)
+	{
+		return dijkstra_shortest_path<heap_t>(graph, start, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t>
+	[[nodiscard]] auto dijkstra_shortest_path(graph_t& graph, vertex_index_t start)
+	{
+		return dijkstra_shortest_path<heap_t, graph_t>(graph, std::ranges::single_view(start));
+	}
+
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename visitor_t, typename index_t, typename weight_invokable_t>
+	bool dijkstra_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		return detail::basic_dijkstra<detail::resolve_heap<heap_t>::template templ, detail::bind_dijkstra_queue_entry_t<detail::dijkstra_predecessor_t>::templ>(graph, start, visitor, workspace, detail::widened_weight_invokable<graph_t>(weight_invokable));
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename visitor_t, typename index_t, typename weight_invokable_t>
+	bool dijkstra_shortest_path(graph_t& graph, vertex_index_t start, visitor_t visitor, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		return dijkstra_shortest_path<heap_t>(graph, std::ranges::single_view(start), visitor, workspace, weight_invokable);
+	}
+	// Return type is a list of (vertex index, distance from start, predecessor) for the reached vertices only,
+	// in the order they were visited. Costs are proportional to the explored part of the graph.
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename index_t, typename weight_invokable_t>
+	[[nodiscard]] auto dijkstra_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>>;
+		using vertex_index_t = vertex_index_type<graph_t>;
+
+		std::vector<std::tuple<vertex_index_t, scalar_t, vertex_index_t>> result;
 		auto visitor = [&result](vertex_index_t vertex, scalar_t distance, vertex_index_t predecessor) -> bool {
-			result[vertex] = { distance, predecessor };
-			//	maybe break; if vertex is an end node
+			result.emplace_back(vertex, distance, predecessor);
 			return false;
 		};
-		auto has_been_visited = [&result](vertex_index_t index){
-			return result[index].second != no_predecessor;
+		dijkstra_shortest_path<heap_t>(graph, start, std::move(visitor), workspace, weight_invokable);
+		return result;
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename index_t, typename weight_invokable_t>
+	[[nodiscard]] auto dijkstra_shortest_path(graph_t& graph, vertex_index_t start, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		return dijkstra_shortest_path<heap_t>(graph, std::ranges::single_view(start), workspace, weight_invokable);
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename index_t>
+	[[nodiscard]] auto dijkstra_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, search_workspace<index_t>& workspace)
+	{
+		return dijkstra_shortest_path<heap_t>(graph, start, workspace, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename index_t>
+	[[nodiscard]] auto dijkstra_shortest_path(graph_t& graph, vertex_index_t start, search_workspace<index_t>& workspace)
+	{
+		return dijkstra_shortest_path<heap_t>(graph, std::ranges::single_view(start), workspace);
+	}
+
+	namespace detail
+	{
+		// One bucket for every weight up to the largest one, which takes a pass over the edges.
+		template<typename graph_t, typename weight_invokable_t>
+		[[nodiscard]] std::size_t dial_span(graph_t& graph, weight_invokable_t& weight_invokable)
+		{
+			std::size_t largest = 0;
+			for(vertex_index_t index = 0; index < graph.V.size(); ++index)
+				for(auto const& out_edge : graph.V[index].out_edges)
+					largest = std::max<std::size_t>(largest, weight_invokable(std::as_const(index), out_edge));
+			return largest + 1;
+		}
+	}
+
+	// Dial's algorithm: Dijkstra on a circular bucket queue with one bucket per weight up to the largest edge weight,
+	// so every queue operation is O(1) amortized instead of O(log V).
+	// Requires is_dial_weight_v<scalar_t>; distances are computed and reported as dial_distance_t.
+	// visitor shall have the signature bool(vertex_index_t, dial_distance_t, vertex_index_t).
+	// If visitor returns true, exit the search and return true.
+	// Returns false if no visitation returned true.
+	// has_been_visited shall have the signature bool(vertex_index_t)
+	// and shall return true iff the vertex has been visited by visitor.
+	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t).
+	template<typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+	bool dial_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>;
+		static_assert(is_dial_weight_v<scalar_t>, "Dial's algorithm needs narrow unsigned integer weights");
+		using widened_t = detail::widened_weight_invokable_t<graph_t, weight_invokable_t>;
+		using queue_entry_t = detail::dijkstra_queue_entry_type<detail::bind_dijkstra_queue_entry_t<detail::dijkstra_predecessor_t>::templ, graph_t, widened_t>;
+
+		bucket_queue<queue_entry_t> queue(detail::dial_span(graph, weight_invokable));
+		return detail::basic_dijkstra<bucket_queue, detail::bind_dijkstra_queue_entry_t<detail::dijkstra_predecessor_t>::templ, graph_t, visitor_t, has_been_visited_t, widened_t>(graph, start, visitor, has_been_visited, detail::widened_weight_invokable<graph_t>(weight_invokable), queue);
+	}
+	template<typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+	bool dial_shortest_path(graph_t& graph, vertex_index_t start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
+	{
+		return dial_shortest_path<graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, std::ranges::single_view(start), visitor, has_been_visited, weight_invokable);
+	}
+	// Return type is a map from vertex index to (distance from start, predecessor)
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto dial_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, weight_invokable_t weight_invokable)
+	{
+		return detail::dense_shortest_path(graph, inf<dial_distance_t>, [&](auto visitor, auto has_been_visited){
+			dial_shortest_path<graph_t, decltype(visitor), decltype(has_been_visited), weight_invokable_t>(graph, start, std::move(visitor), std::move(has_been_visited), weight_invokable);
+		});
+	}
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto dial_shortest_path(graph_t& graph, vertex_index_t start, weight_invokable_t weight_invokable)
+	{
+		return dial_shortest_path<graph_t, weight_invokable_t>(graph, std::ranges::single_view(start), weight_invokable);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto dial_shortest_path(graph_t& graph, std::ranges::input_range auto const& start)
+	{
+		return dial_shortest_path(graph, start, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto dial_shortest_path(graph_t& graph, vertex_index_t start)
+	{
+		return dial_shortest_path<graph_t>(graph, std::ranges::single_view(start));
+	}
+
+	namespace detail
+	{
+		// The "decrease key" variant: every vertex is in the heap at most once, so the heap is bounded by V
+		// and holds only (distance, vertex) pairs, while the predecessors live in result.
+		// result shall be V entries of (inf, no_predecessor); a vertex is settled once it has left the heap.
+		template<typename graph_t, typename visitor_t, typename weight_invokable_t, typename scalar_t, typename vertex_index_t>
+		bool basic_dijkstra_decrease_key(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, weight_invokable_t weight_invokable, std::vector<std::pair<scalar_t, vertex_index_t>>& result)
+		{
+			using out_edge_t = typename graph_t::out_edge_t;
+			constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
+			assert(result.size() == graph.V.size());
+
+			indexed_heap<scalar_t, vertex_index_t> queue(graph.V.size());
+			for(vertex_index_t index : start) {
+				assert(index < graph.V.size());
+				if(result[index].second == no_predecessor) {
+					result[index] = { scalar_t(0), index };
+					queue.push(index, scalar_t(0));
+				}
+			}
+
+			while(!queue.empty()) {
+				const vertex_index_t index = queue.top().second;
+				if(visitor(std::as_const(index), std::as_const(result[index].first), std::as_const(result[index].second)))
+					return true;
+				queue.pop();
+
+				const scalar_t distance = result[index].first;
+				for(out_edge_t const& edge : graph.V[index].out_edges) {
+					auto& [to_distance, to_predecessor] = result[edge.to];
+					const bool reached = to_predecessor != no_predecessor;
+					if(reached && !queue.contains(edge.to))
+						continue; // settled
+					scalar_t&& edge_weight = weight_invokable(std::as_const(index), edge);
+					assert(distance + std::as_const(edge_weight) >= distance);
+					scalar_t candidate = distance + std::move(edge_weight);
+					if(!reached) {
+						queue.push(edge.to, candidate);
+					} else if(candidate < to_distance) {
+						queue.decrease(edge.to, candidate);
+					} else {
+						continue;
+					}
+					to_distance = std::move(candidate);
+					to_predecessor = index;
+				}
+			}
+			return false;
+		}
+	}
+
+	// Same contract as dijkstra_shortest_path, but uses decrease-key on an indexed_heap instead of inserting duplicates.
+	// The heap holds at most V entries rather than O(E), at the cost of maintaining a position map.
+	// visitor shall have the signature bool(vertex_index_t, scalar_t, vertex_index_t).
+	// If visitor returns true, exit the search and return true.
+	// Returns false if no visitation returned true.
+	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t).
+	template<typename graph_t, typename visitor_t, typename weight_invokable_t>
+	bool dijkstra_shortest_path_decrease_key(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, weight_invokable_t weight_invokable)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>>;
+		using vertex_index_t = vertex_index_type<graph_t>;
+
+		constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
+		std::vector<std::pair<scalar_t, vertex_index_t>> tentative(graph.V.size(), { inf<scalar_t>, no_predecessor });
+		return detail::basic_dijkstra_decrease_key(graph, start, visitor, detail::widened_weight_invokable<graph_t>(weight_invokable), tentative);
+	}
+	template<typename graph_t, typename visitor_t, typename weight_invokable_t>
+	bool dijkstra_shortest_path_decrease_key(graph_t& graph, vertex_index_t start, visitor_t visitor, weight_invokable_t weight_invokable)
+	{
+		return dijkstra_shortest_path_decrease_key<graph_t, visitor_t, weight_invokable_t>(graph, std::ranges::single_view(start), visitor, weight_invokable);
+	}
+	// Return type is a map from vertex index to (distance from start, predecessor)
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto dijkstra_shortest_path_decrease_key(graph_t& graph, std::ranges::input_range auto const& start, weight_invokable_t weight_invokable)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>>;
+		using vertex_index_t = vertex_index_type<graph_t>;
+
+		constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
+		std::vector<std::pair<scalar_t, vertex_index_t>> result(graph.V.size(), { inf<scalar_t>, no_predecessor });
+		auto visitor = [](vertex_index_t, scalar_t const&, vertex_index_t) -> bool {
+			return false;
 		};
-		dijkstra_shortest_path<graph_t, decltype(visitor), decltype(has_been_visited), weight_invokable_t>(graph, start, std::move(visitor), std::move(has_been_visited), weight_invokable);
+		detail::basic_dijkstra_decrease_key(graph, start, visitor, detail::widened_weight_invokable<graph_t>(weight_invokable), result);
 		return result;
 	}
 	template<typename graph_t, typename weight_invokable_t>
-	[[nodiscard]] auto dijkstra_shortest_path(graph_t& graph, vertex_index_t start, weight_invokable_t weight_invokable)
+	[[nodiscard]] auto dijkstra_shortest_path_decrease_key(graph_t& graph, vertex_index_t start, weight_invokable_t weight_invokable)
 	{
-		return dijkstra_shortest_path<graph_t, weight_invokable_t>(graph, std::ranges::single_view(start), weight_invokable);
+		return dijkstra_shortest_path_decrease_key<graph_t, weight_invokable_t>(graph, std::ranges::single_view(start), weight_invokable);
 	}
 	template<typename graph_t>
-	[[nodiscard]] auto dijkstra_shortest_path(graph_t& graph, std::ranges::input_range auto const& start)
+	[[nodiscard]] auto dijkstra_shortest_path_decrease_key(graph_t& graph, std::ranges::input_range auto const& start)
 	{
-		return dijkstra_shortest_path(graph, start, dijkstra_default_weight_invokable<graph_t>());
+		return dijkstra_shortest_path_decrease_key(graph, start, dijkstra_default_weight_invokable<graph_t>());
 	}
 	template<typename graph_t>
-	[[nodiscard]] auto dijkstra_shortest_path(graph_t& graph, vertex_index_t start)
+	[[nodiscard]] auto dijkstra_shortest_path_decrease_key(graph_t& graph, vertex_index_t start)
+	{
+		return dijkstra_shortest_path_decrease_key<graph_t>(graph, std::ranges::single_view(start));
+	}
+
+	namespace detail
+	{
+		// The workspace buffer of dijkstra_shortest_path_to_targets, a type of its own so that no other search shares it.
+		// targets is only traversed once, into marked, so that single pass ranges work as well.
+		template<typename index_t>
+		struct dijkstra_target_marks
+		{
+			std::vector<char> marks;
+			std::vector<index_t> marked; // the distinct targets
+		};
+		// Unmarks the targets on scope exit, so that the marks are clean even if the visitor or weight_invokable throws.
+		template<typename index_t>
+		struct dijkstra_target_marks_guard
+		{
+			dijkstra_target_marks<index_t>& buffer;
+
+			~dijkstra_target_marks_guard()
+			{
+				for(index_t const target : buffer.marked)
+					buffer.marks[target] = false;
+				buffer.marked.clear();
+			}
+		};
+	}
+
+	// Like the sparse dijkstra_shortest_path, but only settles the vertices within distance radius of start (isochrones).
+	// Return type is a list of (vertex index, distance from start, predecessor) in the order they were visited.
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename radius_t, typename index_t, typename weight_invokable_t>
+	[[nodiscard]] auto dijkstra_shortest_path_within(graph_t& graph, std::ranges::input_range auto const& start, radius_t const& radius, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>>;
+		using vertex_index_t = vertex_index_type<graph_t>;
+
+		std::vector<std::tuple<vertex_index_t, scalar_t, vertex_index_t>> result;
+		auto visitor = [&result, &radius](vertex_index_t vertex, scalar_t distance, vertex_index_t predecessor) -> bool {
+			// narrow weights are widened to an unsigned distance, which a signed radius must not wrap around
+			if constexpr(std::is_integral_v<radius_t> && std::is_integral_v<scalar_t>) {
+				if(std::cmp_less(radius, distance))
+					return true;
+			} else if(radius < distance)
+				return true;
+			result.emplace_back(vertex, distance, predecessor);
+			return false;
+		};
+		dijkstra_shortest_path<heap_t>(graph, start, std::move(visitor), workspace, weight_invokable);
+		return result;
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename radius_t, typename index_t, typename weight_invokable_t>
+	[[nodiscard]] auto dijkstra_shortest_path_within(graph_t& graph, vertex_index_t start, radius_t const& radius, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		return dijkstra_shortest_path_within<heap_t>(graph, std::ranges::single_view(start), radius, workspace, weight_invokable);
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename radius_t, typename index_t>
+	[[nodiscard]] auto dijkstra_shortest_path_within(graph_t& graph, std::ranges::input_range auto const& start, radius_t const& radius, search_workspace<index_t>& workspace)
+	{
+		return dijkstra_shortest_path_within<heap_t>(graph, start, radius, workspace, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename radius_t, typename index_t>
+	[[nodiscard]] auto dijkstra_shortest_path_within(graph_t& graph, vertex_index_t start, radius_t const& radius, search_workspace<index_t>& workspace)
+	{
+		return dijkstra_shortest_path_within<heap_t>(graph, std::ranges::single_view(start), radius, workspace);
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename radius_t>
+	[[nodiscard]] auto dijkstra_shortest_path_within(graph_t& graph, vertex_index_t start, radius_t const& radius)
 	{
-		return dijkstra_shortest_path<graph_t>(graph, std::ranges::single_view(start));
+		search_workspace workspace(graph);
+		return dijkstra_shortest_path_within<heap_t>(graph, start, radius, workspace);
 	}
 
-	// TODO: overloads with end node(s)
+	// Like the sparse dijkstra_shortest_path, but stops once k distinct vertices of targets have been settled,
+	// i.e. the k nearest targets and every vertex closer than the k-th of them are in the result.
+	// Stops at the last reachable target if fewer than k are reachable.
+	// Return type is a list of (vertex index, distance from start, predecessor) in the order they were visited.
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename index_t, typename weight_invokable_t>
+	[[nodiscard]] auto dijkstra_shortest_path_to_targets(graph_t& graph, std::ranges::input_range auto const& start, std::ranges::input_range auto const& targets, std::size_t k, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>>;
+		using vertex_index_t = vertex_index_type<graph_t>;
+
+		// the marks are cleared again in O(|targets|), so the workspace keeps its sparse cost
+		auto& buffer = workspace.template buffer<detail::dijkstra_target_marks<vertex_index_t>>();
+		std::vector<char>& is_target = buffer.marks;
+		if(is_target.size() < graph.V.size())
+			is_target.resize(graph.V.size(), false);
+		const detail::dijkstra_target_marks_guard<vertex_index_t> unmark{ buffer };
+		for(vertex_index_t target : targets) {
+			assert(target < graph.V.size());
+			if(is_target[target])
+				continue;
+			buffer.marked.push_back(target);
+			is_target[target] = true;
+		}
+		k = std::min(k, buffer.marked.size());
+
+		std::vector<std::tuple<vertex_index_t, scalar_t, vertex_index_t>> result;
+		std::size_t found = 0;
+		auto visitor = [&](vertex_index_t vertex, scalar_t distance, vertex_index_t predecessor) -> bool {
+			result.emplace_back(vertex, distance, predecessor);
+			return is_target[vertex] && ++found == k;
+		};
+		if(k != 0)
+			dijkstra_shortest_path<heap_t>(graph, start, std::move(visitor), workspace, weight_invokable);
+		else
+			workspace.reset();
+		return result;
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename index_t, typename weight_invokable_t>
+	[[nodiscard]] auto dijkstra_shortest_path_to_targets(graph_t& graph, vertex_index_t start, std::ranges::input_range auto const& targets, std::size_t k, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		return dijkstra_shortest_path_to_targets<heap_t>(graph, std::ranges::single_view(start), targets, k, workspace, weight_invokable);
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename index_t>
+	[[nodiscard]] auto dijkstra_shortest_path_to_targets(graph_t& graph, vertex_index_t start, std::ranges::input_range auto const& targets, std::size_t k, search_workspace<index_t>& workspace)
+	{
+		return dijkstra_shortest_path_to_targets<heap_t>(graph, start, targets, k, workspace, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t>
+	[[nodiscard]] auto dijkstra_shortest_path_to_targets(graph_t& graph, vertex_index_t start, std::ranges::input_range auto const& targets, std::size_t k)
+	{
+		search_workspace workspace(graph);
+		return dijkstra_shortest_path_to_targets<heap_t>(graph, start, targets, k, workspace);
+	}
+	// Stops once all targets have been settled or are found to be unreachable.
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename index_t, typename weight_invokable_t>
+	[[nodiscard]] auto dijkstra_shortest_path_to_targets(graph_t& graph, vertex_index_t start, std::ranges::input_range auto const& targets, search_workspace<index_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		return dijkstra_shortest_path_to_targets<heap_t>(graph, start, targets, ~std::size_t{}, workspace, weight_invokable);
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t, typename index_t>
+	[[nodiscard]] auto dijkstra_shortest_path_to_targets(graph_t& graph, vertex_index_t start, std::ranges::input_range auto const& targets, search_workspace<index_t>& workspace)
+	{
+		return dijkstra_shortest_path_to_targets<heap_t>(graph, start, targets, ~std::size_t{}, workspace);
+	}
+	template<template<typename> typename heap_t = default_heap, typename graph_t>
+	[[nodiscard]] auto dijkstra_shortest_path_to_targets(graph_t& graph, vertex_index_t start, std::ranges::input_range auto const& targets)
+	{
+		return dijkstra_shortest_path_to_targets<heap_t>(graph, start, targets, ~std::size_t{});
+	}
 
-	// if implemented, implement them for bfs_shortest_path too
 	// TODO: out iterator overloads for the *shortest_path variant
 	// TODO: maybe return the same vertex container as the graph. how would the current implementation even work if the vertex data structure were e.g. a hash map?
 	// TODO: maybe offer the functionality to store the result within the vertex data
@@ -0,0 +1,171 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_DIRECTION_OPTIMIZING_BFS_HPP_INCLUDED
+#define QUIVER_SEARCH_DIRECTION_OPTIMIZING_BFS_HPP_INCLUDED
+
+#include <quiver/search/bfs.hpp>
+#include <quiver/adjacency_list.hpp>
+#include <quiver/util.hpp>
+#include <ranges>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <cassert>
+
+namespace quiver
+{
+	namespace detail
+	{
+		// The switching heuristic of Beamer, Asanovic and Patterson, "Direction-Optimizing Breadth-First Search".
+		// Go bottom-up once the frontier has more than 1/alpha of the unexplored edges,
+		// go back to top-down once the frontier has fewer than 1/beta of all vertices.
+		inline constexpr std::size_t direction_optimizing_bfs_alpha = 14;
+		inline constexpr std::size_t direction_optimizing_bfs_beta = 24;
+
+		// in_graph must have the same vertices as graph and an edge v -> u for every edge u -> v of graph.
+		template<typename graph_t, typename in_graph_t, typename visitor_t>
+		bool basic_direction_optimizing_bfs(graph_t& graph, in_graph_t const& in_graph, std::ranges::input_range auto const& start, visitor_t visitor)
+		{
+			using vertex_index_t = vertex_index_type<graph_t>;
+			constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
+
+			const std::size_t V = graph.V.size();
+			assert(in_graph.V.size() == V);
+
+			std::vector<vertex_index_t> predecessor(V, no_predecessor);
+			std::vector<vertex_index_t> frontier, next;
+			std::vector<bool> in_frontier(V, false); // only maintained while going bottom-up
+
+			std::size_t unexplored_edges = 0;
+			for(auto const& vertex : graph.V)
+				unexplored_edges += vertex.out_degree();
+			std::size_t frontier_edges = 0;
+
+			for(vertex_index_t index : start) {
+				assert(index < V);
+				if(predecessor[index] != no_predecessor)
+					continue;
+				predecessor[index] = index;
+				frontier.push_back(index);
+				frontier_edges += graph.V[index].out_degree();
+			}
+			unexplored_edges -= frontier_edges;
+
+			bool bottom_up = false;
+			for(bfs_path_length_t distance = 0; !frontier.empty(); ++distance) {
+				for(vertex_index_t index : frontier)
+					if(visitor(std::as_const(index), std::as_const(distance), std::as_const(predecessor[index])))
+						return true;
+
+				if(!bottom_up && frontier_edges > unexplored_edges / direction_optimizing_bfs_alpha) {
+					bottom_up = true;
+					for(vertex_index_t index : frontier)
+						in_frontier[index] = true;
+				} else if(bottom_up && frontier.size() < V / direction_optimizing_bfs_beta) {
+					bottom_up = false;
+					for(vertex_index_t index : frontier)
+						in_frontier[index] = false;
+				}
+
+				next.clear();
+				if(bottom_up) {
+					// every unvisited vertex looks for a parent in the frontier among its in-neighbors
+					for(vertex_index_t index = 0; index < V; ++index) {
+						if(predecessor[index] != no_predecessor)
+							continue;
+						for(auto const& in_edge : in_graph.V[index].out_edges)
+							if(in_frontier[in_edge.to]) {
+								predecessor[index] = in_edge.to;
+								next.push_back(index);
+								break;
+							}
+					}
+					for(vertex_index_t index : frontier)
+						in_frontier[index] = false;
+					for(vertex_index_t index : next)
+						in_frontier[index] = true;
+				} else {
+					for(vertex_index_t index : frontier)
+						for(auto const& out_edge : graph.V[index].out_edges)
+							if(predecessor[out_edge.to] == no_predecessor) {
+								predecessor[out_edge.to] = index;
+								next.push_back(out_edge.to);
+							}
+				}
+
+				frontier_edges = 0;
+				for(vertex_index_t index : next)
+					frontier_edges += graph.V[index].out_degree();
+				unexplored_edges -= frontier_edges;
+				frontier.swap(next);
+			}
+			return false;
+		}
+	}
+
+	// Same contract as bfs_shortest_path, but switches to bottom-up steps for large frontiers.
+	// Vertices of one level are visited in increasing index order while going bottom-up.
+	// visitor shall have the signature bool(vertex_index_t, bfs_path_length_t, vertex_index_t).
+	// If visitor returns true, exit the search and return true.
+	// Returns false if no visitation returned true.
+	// For directed graphs, transposed shall be transpose(graph), which provides the in-edges.
+	template<typename graph_t, typename transposed_t, typename visitor_t>
+	bool direction_optimizing_bfs_shortest_path(graph_t& graph, transposed_t const& transposed, std::ranges::input_range auto const& start, visitor_t visitor)
+	{
+		return detail::basic_direction_optimizing_bfs<graph_t, transposed_t, visitor_t>(graph, transposed, start, visitor);
+	}
+	template<typename graph_t, typename transposed_t, typename visitor_t>
+	bool direction_optimizing_bfs_shortest_path(graph_t& graph, transposed_t const& transposed, vertex_index_t start, visitor_t visitor)
+	{
+		return direction_optimizing_bfs_shortest_path<graph_t, transposed_t, visitor_t>(graph, transposed, std::ranges::single_view(start), visitor);
+	}
+	template<typename graph_t, typename visitor_t>
+	bool direction_optimizing_bfs_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor)
+	{
+		static_assert(is_undirected_v<std::remove_const_t<graph_t>>, "directed graphs need their transpose for the bottom-up steps");
+		return detail::basic_direction_optimizing_bfs<graph_t, graph_t, visitor_t>(graph, graph, start, visitor);
+	}
+	template<typename graph_t, typename visitor_t>
+	bool direction_optimizing_bfs_shortest_path(graph_t& graph, vertex_index_t start, visitor_t visitor)
+	{
+		return direction_optimizing_bfs_shortest_path<graph_t, visitor_t>(graph, std::ranges::single_view(start), visitor);
+	}
+
+	// Return type is a map from vertex index to (distance from start, predecessor)
+	template<typename graph_t, typename transposed_t>
+	[[nodiscard]] auto direction_optimizing_bfs_shortest_path(graph_t& graph, transposed_t const& transposed, std::ranges::input_range auto const& start)
+	{
+		using vertex_index_t = vertex_index_type<graph_t>;
+		constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
+		std::vector<std::pair<bfs_path_length_t, vertex_index_t>> result(graph.V.size(), { inf<bfs_path_length_t>, no_predecessor });
+		auto visitor = [&result](vertex_index_t vertex, bfs_path_length_t distance, vertex_index_t predecessor) -> bool {
+			result[vertex] = { distance, predecessor };
+			return false;
+		};
+		direction_optimizing_bfs_shortest_path<graph_t, transposed_t, decltype(visitor)>(graph, transposed, start, std::move(visitor));
+		return result;
+	}
+	template<typename graph_t, typename transposed_t>
+	[[nodiscard]] auto direction_optimizing_bfs_shortest_path(graph_t& graph, transposed_t const& transposed, vertex_index_t start)
+	{
+		return direction_optimizing_bfs_shortest_path<graph_t, transposed_t>(graph, transposed, std::ranges::single_view(start));
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto direction_optimizing_bfs_shortest_path(graph_t& graph, std::ranges::input_range auto const& start)
+	{
+		static_assert(is_undirected_v<std::remove_const_t<graph_t>>, "directed graphs need their transpose for the bottom-up steps");
+		return direction_optimizing_bfs_shortest_path<graph_t, graph_t>(graph, graph, start);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto direction_optimizing_bfs_shortest_path(graph_t& graph, vertex_index_t start)
+	{
+		return direction_optimizing_bfs_shortest_path<graph_t>(graph, std::ranges::single_view(start));
+	}
+}
+
+#endif // !QUIVER_SEARCH_DIRECTION_OPTIMIZING_BFS_HPP_INCLUDED
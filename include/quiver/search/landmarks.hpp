@@ -0,0 +1,368 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_LANDMARKS_HPP_INCLUDED
+#define QUIVER_SEARCH_LANDMARKS_HPP_INCLUDED
+
+#include <quiver/search/dijkstra.hpp>
+#include <quiver/adjacency_list.hpp>
+#include <quiver/thread_pool.hpp>
+#include <quiver/exception.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <random>
+#include <ranges>
+#include <vector>
+#include <span>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+
+namespace quiver
+{
+	namespace detail
+	{
+		// the distance type of dijkstra_shortest_path
+		template<typename graph_t, typename weight_invokable_t>
+		using landmark_distance_t = dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const typename graph_t::out_edge_t>>;
+	}
+
+	enum class landmark_selection
+	{
+		farthest, // each landmark is the vertex farthest from the previous ones
+		avoid, // Goldberg and Werneck: descend into the shortest path subtree that the previous landmarks cover worst
+	};
+
+	// Precomputed distances between k landmarks and every vertex, for the ALT lower bounds (A*, landmarks, triangle inequality):
+	// d(v, t) >= d(L, t) - d(L, v) and d(v, t) >= d(v, L) - d(t, L) for every landmark L.
+	// The distances of a vertex are stored contiguously, first the k distances from the landmarks,
+	// then for directed graphs the k distances to the landmarks, so a lower bound reads two rows.
+	// Built by compute_landmarks; save and load store it in a binary format.
+	template<typename scalar_t, typename index_t = vertex_index_t>
+	class landmark_table
+	{
+		static_assert(std::is_trivially_copyable_v<scalar_t>, "landmark distances are serialized bytewise");
+
+	public:
+		using vertex_index_t = index_t;
+		using scalar_type = scalar_t;
+
+	private:
+		static constexpr char magic[4] = { 'Q', 'L', 'M', 'K' };
+		static constexpr std::uint32_t version = 1;
+
+		std::size_t m_vertex_count = 0;
+		bool m_directed = false;
+		std::vector<vertex_index_t> m_landmarks;
+		std::vector<scalar_t> m_distances;
+
+		std::size_t stride() const noexcept
+		{
+			return m_directed ? 2 * m_landmarks.size() : m_landmarks.size();
+		}
+		scalar_t const* row(vertex_index_t index) const noexcept
+		{
+			assert(index < m_vertex_count);
+			return m_distances.data() + index * stride();
+		}
+		// max(bound, lhs - rhs) if both are finite
+		static void raise(scalar_t& bound, scalar_t const& lhs, scalar_t const& rhs) noexcept
+		{
+			if(lhs == inf<scalar_t> || rhs == inf<scalar_t> || !(rhs < lhs))
+				return;
+			bound = std::max(bound, static_cast<scalar_t>(lhs - rhs));
+		}
+
+		template<typename T>
+		static void write(std::ostream& stream, T const* data, std::size_t count)
+		{
+			stream.write(reinterpret_cast<char const*>(data), static_cast<std::streamsize>(count * sizeof(T)));
+		}
+		template<typename T>
+		static void read(std::istream& stream, T* data, std::size_t count)
+		{
+			if(!stream.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(count * sizeof(T))))
+				throw invalid_format("landmark_table: unexpected end of stream");
+		}
+
+	public:
+		landmark_table() noexcept
+		{
+		}
+		// transposed is only used for directed graphs and shall be transpose(graph) then.
+		// weight_invokable is called with the edges of transposed for the distances to the landmarks.
+		// The k Dijkstras from (and to) the landmarks run in parallel on pool.
+		template<typename graph_t, typename transposed_t, typename weight_invokable_t>
+		landmark_table(graph_t const& graph, transposed_t const& transposed, std::ranges::input_range auto const& landmarks, weight_invokable_t weight_invokable, thread_pool& pool)
+		: m_vertex_count(graph.V.size()), m_directed(is_directed_v<std::remove_const_t<graph_t>>)
+		{
+			for(auto index : landmarks) {
+				assert(index < m_vertex_count);
+				m_landmarks.push_back(static_cast<vertex_index_t>(index));
+			}
+			const std::size_t k = m_landmarks.size();
+			m_distances.resize(m_vertex_count * stride());
+			pool.for_each(m_directed ? 2 * k : k, [&](std::size_t, std::size_t i){
+				const auto distances = i < k
+					? dijkstra_shortest_path(graph, m_landmarks[i], weight_invokable)
+					: dijkstra_shortest_path(transposed, m_landmarks[i - k], weight_invokable);
+				for(std::size_t index = 0; index < m_vertex_count; ++index)
+					m_distances[index * stride() + i] = static_cast<scalar_t>(distances[index].first);
+			});
+		}
+
+		std::size_t vertex_count() const noexcept
+		{
+			return m_vertex_count;
+		}
+		bool directed() const noexcept
+		{
+			return m_directed;
+		}
+		std::span<vertex_index_t const> landmarks() const noexcept
+		{
+			return m_landmarks;
+		}
+		// d(landmarks()[i], index), inf if unreachable
+		scalar_t distance_from(std::size_t i, vertex_index_t index) const noexcept
+		{
+			assert(i < m_landmarks.size());
+			return row(index)[i];
+		}
+		// d(index, landmarks()[i]), inf if unreachable
+		scalar_t distance_to(std::size_t i, vertex_index_t index) const noexcept
+		{
+			assert(i < m_landmarks.size());
+			return row(index)[m_directed ? m_landmarks.size() + i : i];
+		}
+
+		// A lower bound of d(from, to). Landmarks that cannot reach, or be reached from, both vertices are skipped.
+		[[nodiscard]] scalar_t lower_bound(vertex_index_t from, vertex_index_t to) const noexcept
+		{
+			const std::size_t k = m_landmarks.size();
+			scalar_t const* from_row = row(from);
+			scalar_t const* to_row = row(to);
+			scalar_t bound = scalar_t(0);
+			for(std::size_t i = 0; i < k; ++i) {
+				raise(bound, to_row[i], from_row[i]);
+				if(!m_directed)
+					raise(bound, from_row[i], to_row[i]);
+			}
+			if(m_directed)
+				for(std::size_t i = k; i < 2 * k; ++i)
+					raise(bound, from_row[i], to_row[i]);
+			return bound;
+		}
+		// A consistent heuristic for searches towards target, like astar_shortest_path(graph, start, target, table.heuristic(target)).
+		[[nodiscard]] auto heuristic(vertex_index_t target) const noexcept
+		{
+			return [this, target](vertex_index_t index){
+				return lower_bound(index, target);
+			};
+		}
+
+		// The binary format is native-endian, with a header that is checked on loading.
+		void save(std::ostream& stream) const
+		{
+			const std::uint64_t header[] = { version, sizeof(scalar_t), sizeof(vertex_index_t), m_directed, m_vertex_count, m_landmarks.size() };
+			write(stream, magic, 4);
+			write(stream, header, std::size(header));
+			write(stream, m_landmarks.data(), m_landmarks.size());
+			write(stream, m_distances.data(), m_distances.size());
+		}
+		// Throws invalid_format if stream does not hold a landmark_table saved with the same scalar and index types.
+		[[nodiscard]] static landmark_table load(std::istream& stream)
+		{
+			char stream_magic[4];
+			std::uint64_t header[6];
+			read(stream, stream_magic, 4);
+			if(!std::equal(stream_magic, stream_magic + 4, magic))
+				throw invalid_format("landmark_table: not a landmark table");
+			read(stream, header, std::size(header));
+			if(header[0] != version || header[1] != sizeof(scalar_t) || header[2] != sizeof(vertex_index_t) || header[3] > 1)
+				throw invalid_format("landmark_table: incompatible version or types");
+
+			landmark_table result;
+			result.m_directed = header[3] != 0;
+			result.m_vertex_count = header[4];
+			result.m_landmarks.resize(header[5]);
+			read(stream, result.m_landmarks.data(), result.m_landmarks.size());
+			for(vertex_index_t index : result.m_landmarks)
+				if(index >= result.m_vertex_count)
+					throw invalid_format("landmark_table: landmark out of range");
+			result.m_distances.resize(result.m_vertex_count * result.stride());
+			read(stream, result.m_distances.data(), result.m_distances.size());
+			return result;
+		}
+	};
+
+	template<typename graph_t, typename transposed_t, typename landmarks_t, typename weight_invokable_t>
+	landmark_table(graph_t const&, transposed_t const&, landmarks_t const&, weight_invokable_t, thread_pool&) -> landmark_table<detail::landmark_distance_t<graph_t, weight_invokable_t>, vertex_index_type<graph_t>>;
+
+	// Picks k landmarks (fewer if the graph has fewer vertices). Both selections run k Dijkstras one after another.
+	// seed determines the random roots of the avoid selection.
+	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t).
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto select_landmarks(graph_t const& graph, std::size_t k, landmark_selection selection, weight_invokable_t weight_invokable, std::uint64_t seed = 0)
+	{
+		using scalar_t = detail::landmark_distance_t<graph_t, weight_invokable_t>;
+		using vertex_index_t = vertex_index_type<graph_t>;
+		constexpr bool directed = is_directed_v<std::remove_const_t<graph_t>>;
+
+		const std::size_t V = graph.V.size();
+		k = std::min(k, V);
+		std::vector<vertex_index_t> result;
+		std::vector<bool> is_landmark(V, false);
+		std::vector<std::vector<std::pair<scalar_t, vertex_index_t>>> from_landmarks;
+
+		// the vertex farthest from all landmarks, preferring vertices no landmark reaches
+		const auto farthest = [&](std::vector<std::pair<scalar_t, vertex_index_t>> const* tree){
+			vertex_index_t best = 0;
+			scalar_t best_distance{};
+			bool any = false;
+			for(std::size_t index = 0; index < V; ++index) {
+				if(is_landmark[index])
+					continue;
+				scalar_t distance = inf<scalar_t>;
+				if(tree)
+					distance = (*tree)[index].first;
+				else
+					for(auto const& distances : from_landmarks)
+						distance = std::min(distance, distances[index].first);
+				if(!any || best_distance < distance) {
+					best = static_cast<vertex_index_t>(index);
+					best_distance = distance;
+					any = true;
+				}
+			}
+			return best;
+		};
+		const auto add = [&](vertex_index_t landmark){
+			result.push_back(landmark);
+			is_landmark[landmark] = true;
+			if(result.size() < k)
+				from_landmarks.push_back(dijkstra_shortest_path(graph, landmark, weight_invokable));
+		};
+
+		if(k == 0)
+			return result;
+		if(selection == landmark_selection::farthest) {
+			const auto tree = dijkstra_shortest_path(graph, vertex_index_t(0), weight_invokable);
+			add(farthest(&tree));
+			while(result.size() < k)
+				add(farthest(nullptr));
+			return result;
+		}
+
+		std::mt19937_64 engine(seed);
+		std::uniform_int_distribution<std::size_t> root_distribution(0, V - 1);
+		std::vector<scalar_t> size(V);
+		std::vector<bool> covered(V);
+		std::vector<std::size_t> child_offsets(V + 1);
+		std::vector<vertex_index_t> children(V), order;
+		while(result.size() < k) {
+			const vertex_index_t root = static_cast<vertex_index_t>(root_distribution(engine));
+			const auto tree = dijkstra_shortest_path(graph, root, weight_invokable);
+			const auto reached = [&tree](std::size_t index){
+				return tree[index].second != ~vertex_index_t{};
+			};
+
+			// the shortest path tree from root in CSR form, then its vertices in preorder
+			std::fill(child_offsets.begin(), child_offsets.end(), 0);
+			for(std::size_t index = 0; index < V; ++index)
+				if(reached(index) && index != root)
+					++child_offsets[tree[index].second + 1];
+			for(std::size_t index = 0; index < V; ++index)
+				child_offsets[index + 1] += child_offsets[index];
+			std::vector<std::size_t> cursor(child_offsets.begin(), child_offsets.end() - 1);
+			for(std::size_t index = 0; index < V; ++index)
+				if(reached(index) && index != root)
+					children[cursor[tree[index].second]++] = static_cast<vertex_index_t>(index);
+			order.assign(1, root);
+			for(std::size_t i = 0; i < order.size(); ++i)
+				for(std::size_t c = child_offsets[order[i]]; c < child_offsets[order[i] + 1]; ++c)
+					order.push_back(children[c]);
+
+			// size(v): how badly the landmarks bound d(root, w), summed over the subtree of v, or 0 if it contains a landmark
+			for(auto it = order.rbegin(); it != order.rend(); ++it) {
+				const vertex_index_t index = *it;
+				scalar_t lower_bound = scalar_t(0);
+				for(auto const& distances : from_landmarks) {
+					scalar_t const& to_root = distances[root].first, to_index = distances[index].first;
+					if(to_root == inf<scalar_t> || to_index == inf<scalar_t>)
+						continue;
+					if(to_root < to_index)
+						lower_bound = std::max(lower_bound, static_cast<scalar_t>(to_index - to_root));
+					if(!directed && to_index < to_root)
+						lower_bound = std::max(lower_bound, static_cast<scalar_t>(to_root - to_index));
+				}
+				size[index] = static_cast<scalar_t>(tree[index].first - std::min(lower_bound, tree[index].first));
+				covered[index] = is_landmark[index];
+				for(std::size_t c = child_offsets[index]; c < child_offsets[index + 1]; ++c) {
+					covered[index] = covered[index] || covered[children[c]];
+					size[index] += size[children[c]];
+				}
+				if(covered[index])
+					size[index] = scalar_t(0);
+			}
+
+			// descend into the child of maximum size until reaching a leaf
+			vertex_index_t landmark = root;
+			for(;;) {
+				vertex_index_t next = landmark;
+				scalar_t next_size = scalar_t(0);
+				for(std::size_t c = child_offsets[landmark]; c < child_offsets[landmark + 1]; ++c)
+					if(next_size < size[children[c]]) {
+						next = children[c];
+						next_size = size[children[c]];
+					}
+				if(next == landmark)
+					break;
+				landmark = next;
+			}
+			add(is_landmark[landmark] ? farthest(nullptr) : landmark);
+		}
+		return result;
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto select_landmarks(graph_t const& graph, std::size_t k, landmark_selection selection = landmark_selection::farthest)
+	{
+		return select_landmarks(graph, k, selection, dijkstra_default_weight_invokable<graph_t>());
+	}
+
+	// Precomputes the landmark_table of graph for the given landmarks, running the Dijkstras in parallel on pool.
+	// For directed graphs, transposed shall be transpose(graph) and weight_invokable is also called with its edges.
+	template<typename graph_t, typename transposed_t, typename weight_invokable_t>
+	[[nodiscard]] auto compute_landmarks(graph_t const& graph, transposed_t const& transposed, std::ranges::input_range auto const& landmarks, weight_invokable_t weight_invokable, thread_pool& pool)
+	{
+		return landmark_table(graph, transposed, landmarks, weight_invokable, pool);
+	}
+	template<typename graph_t, typename transposed_t>
+	[[nodiscard]] auto compute_landmarks(graph_t const& graph, transposed_t const& transposed, std::ranges::input_range auto const& landmarks)
+	{
+		thread_pool pool;
+		return compute_landmarks(graph, transposed, landmarks, dijkstra_default_weight_invokable<graph_t>(), pool);
+	}
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto compute_landmarks(graph_t const& graph, std::ranges::input_range auto const& landmarks, weight_invokable_t weight_invokable, thread_pool& pool)
+	{
+		static_assert(is_undirected_v<std::remove_const_t<graph_t>>, "directed graphs need their transpose for the distances to the landmarks");
+		return landmark_table(graph, graph, landmarks, weight_invokable, pool);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto compute_landmarks(graph_t const& graph, std::ranges::input_range auto const& landmarks)
+	{
+		thread_pool pool;
+		return compute_landmarks(graph, landmarks, dijkstra_default_weight_invokable<graph_t>(), pool);
+	}
+}
+
+#endif // !QUIVER_SEARCH_LANDMARKS_HPP_INCLUDED
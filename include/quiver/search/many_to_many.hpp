@@ -0,0 +1,284 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_MANY_TO_MANY_HPP_INCLUDED
+#define QUIVER_SEARCH_MANY_TO_MANY_HPP_INCLUDED
+
+#include <quiver/search/contraction_hierarchy.hpp>
+#include <quiver/search/dijkstra.hpp>
+#include <quiver/search/search_workspace.hpp>
+#include <quiver/adjacency_list.hpp>
+#include <quiver/thread_pool.hpp>
+#include <quiver/heaps.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <ranges>
+#include <vector>
+#include <span>
+#include <utility>
+#include <cstddef>
+#include <cassert>
+
+namespace quiver
+{
+	// A dense |sources| x |targets| matrix of distances, stored row-major.
+	template<typename scalar_t>
+	class distance_matrix
+	{
+		std::size_t m_rows = 0, m_columns = 0;
+		std::vector<scalar_t> m_data;
+
+	public:
+		using scalar_type = scalar_t;
+
+		distance_matrix() noexcept
+		{
+		}
+		distance_matrix(std::size_t rows, std::size_t columns)
+		: m_rows(rows), m_columns(columns), m_data(rows * columns, inf<scalar_t>)
+		{
+		}
+
+		std::size_t rows() const noexcept
+		{
+			return m_rows;
+		}
+		std::size_t columns() const noexcept
+		{
+			return m_columns;
+		}
+		scalar_t& operator()(std::size_t row, std::size_t column) noexcept
+		{
+			assert(row < m_rows && column < m_columns);
+			return m_data[row * m_columns + column];
+		}
+		scalar_t const& operator()(std::size_t row, std::size_t column) const noexcept
+		{
+			assert(row < m_rows && column < m_columns);
+			return m_data[row * m_columns + column];
+		}
+		std::span<scalar_t> row(std::size_t row) noexcept
+		{
+			assert(row < m_rows);
+			return { m_data.data() + row * m_columns, m_columns };
+		}
+		std::span<scalar_t const> row(std::size_t row) const noexcept
+		{
+			assert(row < m_rows);
+			return { m_data.data() + row * m_columns, m_columns };
+		}
+		std::span<scalar_t> data() noexcept
+		{
+			return m_data;
+		}
+		std::span<scalar_t const> data() const noexcept
+		{
+			return m_data;
+		}
+	};
+
+	namespace detail
+	{
+		// Per-thread state of a full upward search in a contraction_hierarchy.
+		template<typename scalar_t, typename index_t>
+		struct upward_search_t
+		{
+			search_workspace<index_t> reached;
+			std::vector<scalar_t> distance;
+			min_heap<std::pair<scalar_t, index_t>> queue;
+
+			explicit upward_search_t(std::size_t V)
+			: reached(V), distance(V)
+			{
+			}
+
+			// Calls visitor(index, distance) for every vertex settled from start, along the upward arcs if forward, else the downward ones.
+			template<typename visitor_t>
+			void run(contraction_hierarchy<scalar_t, index_t> const& hierarchy, index_t start, bool forward, visitor_t&& visitor)
+			{
+				reached.reset();
+				queue.clear();
+				reached.set(start);
+				distance[start] = scalar_t(0);
+				queue.push(scalar_t(0), start);
+				while(!queue.empty()) {
+					const auto [d, index] = queue.extract_top();
+					if(distance[index] < d)
+						continue;
+					visitor(index, d);
+					for(auto const& arc : forward ? hierarchy.up_arcs(index) : hierarchy.down_arcs(index)) {
+						const scalar_t candidate = d + arc.weight;
+						if(!reached(arc.to) || candidate < distance[arc.to]) {
+							reached.set(arc.to);
+							distance[arc.to] = candidate;
+							queue.push(candidate, arc.to);
+						}
+					}
+				}
+			}
+		};
+	}
+
+	// Distances from every source to every target (Knopp et al.): a backward upward search from each target
+	// leaves (target, distance) entries in buckets at the vertices it settles, then a forward upward search from
+	// each source scans the buckets of its settled vertices. Every shortest path meets at its highest vertex,
+	// so the minimum over the buckets is the distance.
+	// Both phases distribute their searches over pool; only the buckets and the result are kept.
+	// Unreachable pairs are inf.
+	template<typename scalar_t, typename index_t>
+	[[nodiscard]] distance_matrix<scalar_t> many_to_many(contraction_hierarchy<scalar_t, index_t> const& hierarchy, std::ranges::input_range auto const& sources, std::ranges::input_range auto const& targets, thread_pool& pool)
+	{
+		struct bucket_entry_t
+		{
+			index_t index; // the vertex for collecting, the column in the buckets
+			scalar_t distance;
+		};
+		const std::size_t V = hierarchy.size();
+		const std::vector<index_t> source_list(std::ranges::begin(sources), std::ranges::end(sources));
+		const std::vector<index_t> target_list(std::ranges::begin(targets), std::ranges::end(targets));
+		distance_matrix<scalar_t> result(source_list.size(), target_list.size());
+
+		std::vector<detail::upward_search_t<scalar_t, index_t>> searches;
+		searches.reserve(pool.size());
+		for(std::size_t i = 0; i < pool.size(); ++i)
+			searches.emplace_back(V);
+
+		// the backward search spaces, per thread, then sorted into buckets by vertex
+		std::vector<std::vector<std::pair<index_t, bucket_entry_t>>> search_spaces(pool.size());
+		pool.for_each(target_list.size(), [&](std::size_t thread_index, std::size_t column){
+			assert(target_list[column] < V);
+			searches[thread_index].run(hierarchy, target_list[column], false, [&](index_t index, scalar_t const& distance){
+				search_spaces[thread_index].push_back({ index, { static_cast<index_t>(column), distance } });
+			});
+		});
+		std::vector<std::size_t> bucket_offsets(V + 1, 0);
+		for(auto const& search_space : search_spaces)
+			for(auto const& entry : search_space)
+				++bucket_offsets[entry.first + 1];
+		for(std::size_t index = 0; index < V; ++index)
+			bucket_offsets[index + 1] += bucket_offsets[index];
+		std::vector<bucket_entry_t> buckets(bucket_offsets.back());
+		{
+			std::vector<std::size_t> cursor(bucket_offsets.begin(), bucket_offsets.end() - 1);
+			for(auto& search_space : search_spaces) {
+				for(auto const& entry : search_space)
+					buckets[cursor[entry.first]++] = entry.second;
+				std::vector<std::pair<index_t, bucket_entry_t>>().swap(search_space);
+			}
+		}
+
+		pool.for_each(source_list.size(), [&](std::size_t thread_index, std::size_t row_index){
+			assert(source_list[row_index] < V);
+			const std::span<scalar_t> row = result.row(row_index);
+			searches[thread_index].run(hierarchy, source_list[row_index], true, [&](index_t index, scalar_t const& distance){
+				for(std::size_t i = bucket_offsets[index]; i < bucket_offsets[index + 1]; ++i) {
+					const scalar_t candidate = distance + buckets[i].distance;
+					scalar_t& entry = row[buckets[i].index];
+					entry = std::min(entry, candidate);
+				}
+			});
+		});
+		return result;
+	}
+	template<typename scalar_t, typename index_t>
+	[[nodiscard]] distance_matrix<scalar_t> many_to_many(contraction_hierarchy<scalar_t, index_t> const& hierarchy, std::ranges::input_range auto const& sources, std::ranges::input_range auto const& targets)
+	{
+		thread_pool pool;
+		return many_to_many(hierarchy, sources, targets, pool);
+	}
+
+	// Distances from every source to every target without preprocessing: one Dijkstra per source, distributed over pool,
+	// each stopping once all targets are settled. Every thread reuses its search state, so no V-sized result is allocated per source.
+	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t).
+	// The distances are dijkstra_distance_t<scalar_t>; unreachable pairs are inf.
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto many_to_many(graph_t const& graph, std::ranges::input_range auto const& sources, std::ranges::input_range auto const& targets, weight_invokable_t weight_invokable, thread_pool& pool)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = dijkstra_distance_t<std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>>;
+		using vertex_index_t = vertex_index_type<graph_t>;
+
+		const std::size_t V = graph.V.size();
+		const std::vector<vertex_index_t> source_list(std::ranges::begin(sources), std::ranges::end(sources));
+		const std::vector<vertex_index_t> target_list(std::ranges::begin(targets), std::ranges::end(targets));
+		distance_matrix<scalar_t> result(source_list.size(), target_list.size());
+
+		// the columns of each vertex, as targets may repeat
+		std::vector<std::size_t> column_offsets(V + 1, 0);
+		for(vertex_index_t target : target_list) {
+			assert(target < V);
+			++column_offsets[target + 1];
+		}
+		const std::size_t distinct_targets = V - static_cast<std::size_t>(std::count(column_offsets.begin() + 1, column_offsets.end(), 0));
+		for(std::size_t index = 0; index < V; ++index)
+			column_offsets[index + 1] += column_offsets[index];
+		std::vector<std::size_t> columns(target_list.size());
+		{
+			std::vector<std::size_t> cursor(column_offsets.begin(), column_offsets.end() - 1);
+			for(std::size_t column = 0; column < target_list.size(); ++column)
+				columns[cursor[target_list[column]]++] = column;
+		}
+
+		struct search_t
+		{
+			search_workspace<vertex_index_t> reached;
+			std::vector<scalar_t> distance;
+			min_heap<std::pair<scalar_t, vertex_index_t>> queue;
+		};
+		std::vector<search_t> searches(pool.size());
+		pool.for_each(source_list.size(), [&](std::size_t thread_index, std::size_t row_index){
+			search_t& search = searches[thread_index];
+			if(search.distance.size() != V) {
+				search.reached.reset(V);
+				search.distance.resize(V);
+			}
+			search.reached.reset();
+			search.queue.clear();
+
+			const vertex_index_t source = source_list[row_index];
+			assert(source < V);
+			const std::span<scalar_t> row = result.row(row_index);
+			search.reached.set(source);
+			search.distance[source] = scalar_t(0);
+			search.queue.push(scalar_t(0), source);
+			for(std::size_t remaining = distinct_targets; remaining != 0 && !search.queue.empty();) {
+				const auto [distance, index] = search.queue.extract_top();
+				if(search.distance[index] < distance)
+					continue;
+				if(column_offsets[index] != column_offsets[index + 1]) {
+					for(std::size_t i = column_offsets[index]; i < column_offsets[index + 1]; ++i)
+						row[columns[i]] = distance;
+					--remaining;
+				}
+				for(out_edge_t const& edge : graph.V[index].out_edges) {
+					const scalar_t candidate = distance + weight_invokable(index, edge);
+					assert(!(candidate < distance));
+					if(!search.reached(edge.to) || candidate < search.distance[edge.to]) {
+						search.reached.set(edge.to);
+						search.distance[edge.to] = candidate;
+						search.queue.push(candidate, edge.to);
+					}
+				}
+			}
+		});
+		return result;
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto many_to_many(graph_t const& graph, std::ranges::input_range auto const& sources, std::ranges::input_range auto const& targets, thread_pool& pool)
+	{
+		return many_to_many(graph, sources, targets, dijkstra_default_weight_invokable<graph_t>(), pool);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto many_to_many(graph_t const& graph, std::ranges::input_range auto const& sources, std::ranges::input_range auto const& targets)
+	{
+		thread_pool pool;
+		return many_to_many(graph, sources, targets, pool);
+	}
+}
+
+#endif // !QUIVER_SEARCH_MANY_TO_MANY_HPP_INCLUDED
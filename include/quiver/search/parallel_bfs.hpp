@@ -0,0 +1,99 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_PARALLEL_BFS_HPP_INCLUDED
+#define QUIVER_SEARCH_PARALLEL_BFS_HPP_INCLUDED
+
+#include <quiver/search/bfs.hpp>
+#include <quiver/adjacency_list.hpp>
+#include <quiver/thread_pool.hpp>
+#include <quiver/util.hpp>
+#include <ranges>
+#include <vector>
+#include <atomic>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+
+namespace quiver
+{
+	// Level-synchronous breadth first search: every frontier is expanded by all threads of pool,
+	// vertices are claimed through an atomic visited bitmap and each thread collects its share
+	// of the next frontier in its own buffer before the buffers are merged.
+	// Return type is a map from vertex index to (distance from start, predecessor), like bfs_shortest_path.
+	// Which of several equally distant predecessors is recorded depends on scheduling.
+	template<typename graph_t>
+	[[nodiscard]] auto parallel_bfs_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, thread_pool& pool)
+	{
+		using vertex_index_t = vertex_index_type<graph_t>;
+		constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
+		constexpr std::size_t word_bits = 64;
+
+		const std::size_t V = graph.V.size();
+		std::vector<std::pair<bfs_path_length_t, vertex_index_t>> result(V, { inf<bfs_path_length_t>, no_predecessor });
+		std::vector<std::atomic<std::uint64_t>> visited((V + word_bits - 1) / word_bits);
+		const auto claim = [&visited](vertex_index_t index) noexcept -> bool {
+			std::atomic<std::uint64_t>& word = visited[index / word_bits];
+			const std::uint64_t mask = std::uint64_t{1} << (index % word_bits);
+			// the relaxed load avoids most read-modify-writes on already visited vertices
+			return !(word.load(std::memory_order_relaxed) & mask) && !(word.fetch_or(mask, std::memory_order_relaxed) & mask);
+		};
+
+		std::vector<vertex_index_t> frontier, next;
+		for(vertex_index_t index : start) {
+			assert(index < V);
+			if(claim(index)) {
+				result[index] = { 0, index };
+				frontier.push_back(index);
+			}
+		}
+
+		std::vector<std::vector<vertex_index_t>> local_next(pool.size());
+		std::vector<std::size_t> offsets(pool.size() + 1);
+		for(bfs_path_length_t distance = 1; !frontier.empty(); ++distance) {
+			// each vertex is claimed by exactly one thread, which is the only one writing its result
+			pool.for_each(frontier.size(), [&](std::size_t thread_index, std::size_t i){
+				const vertex_index_t index = frontier[i];
+				for(auto const& out_edge : graph.V[index].out_edges)
+					if(claim(out_edge.to)) {
+						result[out_edge.to] = { distance, index };
+						local_next[thread_index].push_back(out_edge.to);
+					}
+			});
+
+			offsets[0] = 0;
+			for(std::size_t t = 0; t < pool.size(); ++t)
+				offsets[t + 1] = offsets[t] + local_next[t].size();
+			next.resize(offsets.back());
+			pool.run([&](std::size_t thread_index){
+				std::copy(local_next[thread_index].begin(), local_next[thread_index].end(), next.begin() + offsets[thread_index]);
+				local_next[thread_index].clear();
+			});
+			frontier.swap(next);
+		}
+		return result;
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto parallel_bfs_shortest_path(graph_t& graph, vertex_index_t start, thread_pool& pool)
+	{
+		return parallel_bfs_shortest_path<graph_t>(graph, std::ranges::single_view(start), pool);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto parallel_bfs_shortest_path(graph_t& graph, std::ranges::input_range auto const& start)
+	{
+		thread_pool pool;
+		return parallel_bfs_shortest_path<graph_t>(graph, start, pool);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto parallel_bfs_shortest_path(graph_t& graph, vertex_index_t start)
+	{
+		return parallel_bfs_shortest_path<graph_t>(graph, std::ranges::single_view(start));
+	}
+}
+
+#endif // !QUIVER_SEARCH_PARALLEL_BFS_HPP_INCLUDED
@@ -0,0 +1,145 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_SEARCH_WORKSPACE_HPP_INCLUDED
+#define QUIVER_SEARCH_SEARCH_WORKSPACE_HPP_INCLUDED
+
+#include <quiver/typedefs.hpp>
+#include <vector>
+#include <memory>
+#include <span>
+#include <utility>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+
+namespace quiver
+{
+	namespace detail
+	{
+		// Only the address matters; it identifies T without RTTI.
+		template<typename T>
+		inline constexpr char search_workspace_buffer_key = 0;
+	}
+
+	// Scratch state for running many searches on the same graph.
+	// The visited marks are stamped with an epoch, so reset() is O(1) instead of O(V),
+	// and the queues and heaps used by the searches stay allocated between queries.
+	// Provides the same interface as visitation_table_t, and the searches accept it in place of one.
+	template<typename index_t = vertex_index_t>
+	class search_workspace
+	{
+		using epoch_t = std::uint32_t;
+
+		struct buffer_t
+		{
+			void const* key;
+			std::unique_ptr<void, void(*)(void*)> object;
+		};
+
+		std::vector<epoch_t> m_stamps;
+		epoch_t m_epoch = 1;
+		std::vector<index_t> m_touched;
+		std::vector<buffer_t> m_buffers;
+
+	public:
+		using vertex_index_t = index_t;
+
+		[[nodiscard]] search_workspace() noexcept
+		{
+		}
+		[[nodiscard]] explicit search_workspace(std::size_t n)
+		: m_stamps(n, 0)
+		{
+		}
+		template<typename graph_t>
+		requires requires(graph_t const& graph) { graph.V.size(); }
+		[[nodiscard]] explicit search_workspace(graph_t const& graph)
+		: search_workspace(graph.V.size())
+		{
+		}
+
+		search_workspace(search_workspace const& rhs) = delete;
+		search_workspace(search_workspace&& rhs) noexcept = default;
+		search_workspace& operator=(search_workspace const& rhs) = delete;
+		search_workspace& operator=(search_workspace&& rhs) noexcept = default;
+
+		std::size_t size() const noexcept
+		{
+			return m_stamps.size();
+		}
+
+		// Unmarks all vertices. Amortized O(1).
+		void reset() noexcept
+		{
+			m_touched.clear();
+			if(++m_epoch == 0) {
+				// the epoch wrapped around, so old stamps could collide with new ones
+				std::fill(m_stamps.begin(), m_stamps.end(), 0);
+				m_epoch = 1;
+			}
+		}
+		// Unmarks all vertices and makes room for n vertices.
+		void reset(std::size_t n)
+		{
+			if(n > m_stamps.size())
+				m_stamps.resize(n, 0);
+			reset();
+		}
+
+		void set(vertex_index_t index)
+		{
+			assert(index < m_stamps.size());
+			if(m_stamps[index] != m_epoch) {
+				m_stamps[index] = m_epoch;
+				m_touched.push_back(index);
+			}
+		}
+		[[nodiscard]] bool operator()(vertex_index_t index) const noexcept
+		{
+			assert(index < m_stamps.size());
+			return m_stamps[index] == m_epoch;
+		}
+
+		// The vertices marked since the last reset, in the order they were marked.
+		[[nodiscard]] std::span<vertex_index_t const> touched() const noexcept
+		{
+			return m_touched;
+		}
+
+		template<typename visitor_t>
+		[[nodiscard]] auto hook_visitor(visitor_t& visitor) noexcept
+		{
+			return [this, &visitor](vertex_index_t index, auto&&... tail) -> bool {
+				this->set(index);
+				return visitor(index, std::forward<decltype(tail)>(tail)...);
+			};
+		}
+
+		// A default constructed T owned by the workspace; the same object is returned on every call.
+		// Its contents are whatever the previous user left in it.
+		template<typename T>
+		[[nodiscard]] T& buffer()
+		{
+			void const* const key = &detail::search_workspace_buffer_key<T>;
+			for(buffer_t const& buffer : m_buffers)
+				if(buffer.key == key)
+					return *static_cast<T*>(buffer.object.get());
+
+			m_buffers.reserve(m_buffers.size() + 1); // so that emplace_back cannot throw and leak the object
+			T* const object = new T();
+			m_buffers.push_back({ key, { object, [](void* object){ delete static_cast<T*>(object); } } });
+			return *object;
+		}
+	};
+
+	template<typename graph_t>
+	search_workspace(graph_t const&) -> search_workspace<vertex_index_type<graph_t>>;
+}
+
+#endif // !QUIVER_SEARCH_SEARCH_WORKSPACE_HPP_INCLUDED
@@ -0,0 +1,89 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_SEMIRING_HPP_INCLUDED
+#define QUIVER_SEARCH_SEMIRING_HPP_INCLUDED
+
+#include <quiver/util.hpp>
+#include <algorithm>
+#include <limits>
+
+namespace quiver
+{
+	// A path algebra for Dijkstra, instantiated with the weight type:
+	// zero() is the distance of unreachable vertices, one() the distance of the start vertices,
+	// extend(distance, weight) the distance over one more edge, and better(lhs, rhs) the strict order in which vertices are settled.
+	// Dijkstra is only correct if extend(distance, weight) is never better than distance.
+
+	// Shortest paths, the default.
+	template<typename scalar_t>
+	struct min_plus_semiring
+	{
+		[[nodiscard]] static constexpr scalar_t zero() noexcept
+		{
+			return inf<scalar_t>;
+		}
+		[[nodiscard]] static constexpr scalar_t one() noexcept
+		{
+			return scalar_t(0);
+		}
+		[[nodiscard]] static constexpr scalar_t extend(scalar_t const& distance, scalar_t const& weight) noexcept
+		{
+			return distance + weight;
+		}
+		[[nodiscard]] static constexpr bool better(scalar_t const& lhs, scalar_t const& rhs) noexcept
+		{
+			return lhs < rhs;
+		}
+	};
+
+	// Widest (bottleneck) paths: the distance is the smallest weight on the path, which is maximized.
+	template<typename scalar_t>
+	struct max_min_semiring
+	{
+		[[nodiscard]] static constexpr scalar_t zero() noexcept
+		{
+			return std::numeric_limits<scalar_t>::lowest();
+		}
+		[[nodiscard]] static constexpr scalar_t one() noexcept
+		{
+			return inf<scalar_t>;
+		}
+		[[nodiscard]] static constexpr scalar_t extend(scalar_t const& distance, scalar_t const& weight) noexcept
+		{
+			return std::min(distance, weight);
+		}
+		[[nodiscard]] static constexpr bool better(scalar_t const& lhs, scalar_t const& rhs) noexcept
+		{
+			return rhs < lhs;
+		}
+	};
+
+	// Most reliable paths: the distance is the product of the weights, which shall be probabilities in [0, 1], and is maximized.
+	template<typename scalar_t>
+	struct max_times_semiring
+	{
+		[[nodiscard]] static constexpr scalar_t zero() noexcept
+		{
+			return scalar_t(0);
+		}
+		[[nodiscard]] static constexpr scalar_t one() noexcept
+		{
+			return scalar_t(1);
+		}
+		[[nodiscard]] static constexpr scalar_t extend(scalar_t const& distance, scalar_t const& weight) noexcept
+		{
+			return distance * weight;
+		}
+		[[nodiscard]] static constexpr bool better(scalar_t const& lhs, scalar_t const& rhs) noexcept
+		{
+			return rhs < lhs;
+		}
+	};
+}
+
+#endif // !QUIVER_SEARCH_SEMIRING_HPP_INCLUDED
@@ -9,8 +9,19 @@
 #ifndef QUIVER_STRONGLY_CONNECTED_COMPONENTS_HPP_INCLUDED
 #define QUIVER_STRONGLY_CONNECTED_COMPONENTS_HPP_INCLUDED
 
+#include <quiver/search/dfs.hpp>
+#include <quiver/operations/transpose.hpp>
 #include <quiver/adjacency_list.hpp>
+#include <quiver/thread_pool.hpp>
+#include <algorithm>
+#include <numeric>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <cassert>
+#include <utility>
+#include <ranges>
 #include <stack>
 #include <vector>
 
@@ -40,14 +51,9 @@ namespace quiver
 			}
 		};
 
-		template<
-			typename edge_properties_t,
-			typename vertex_properties_t,
-			template<typename> class out_edge_container,
-			template<typename> class vertex_container
-		>
+		template<typename graph_t>
 		void tarjan_recurse(const vertex_index_t v,
-							adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> const& graph,
+							graph_t const& graph,
 							tarjan_state& state)
 		{
 			state.scc_index[v] = state.current_scc_index;
@@ -80,15 +86,12 @@ namespace quiver
 		}
 	}
 
-	template<
-		typename edge_properties_t,
-		typename vertex_properties_t,
-		template<typename> class out_edge_container,
-		template<typename> class vertex_container
-	>
+	template<typename graph_t>
 	std::vector<std::size_t> // vertex [0..V] -> scc index
-	tarjan_recursive(adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> const& graph)
+	tarjan_recursive(graph_t const& graph)
 	{
+		static_assert(is_directed_v<graph_t>, "strongly connected components exist in directed graphs");
+
 		tarjan_detail::tarjan_state state(graph.V.size());
 
 		for(vertex_index_t start_node = 0; start_node < graph.V.size(); ++start_node) {
@@ -98,6 +101,358 @@ namespace quiver
 
 		return std::move(state.node_to_scc_index_mapping);
 	}
+
+	// Pearce's single-array variant of Tarjan's algorithm on the iterative dfs_events, so it does not recurse.
+	// rindex holds the DFS index of active vertices, doubles as the discovered marks, and is finally overwritten
+	// with the component. A vertex is pushed onto the component stack only once it has left the DFS stack,
+	// whose frames are a vertex and an edge offset, so the search takes at most 3 vertex_index_t and a bit
+	// per vertex, not counting the slack of the growing stacks. The returned V std::size_t are allocated last.
+	// Returns the same vertex -> scc index mapping as tarjan_recursive, components numbered in order of completion.
+	template<typename graph_t>
+	std::vector<std::size_t> // vertex [0..V] -> scc index
+	pearce_iterative(graph_t const& graph)
+	{
+		static_assert(is_directed_v<graph_t>, "strongly connected components exist in directed graphs");
+		using out_edge_t = typename graph_t::out_edge_t;
+		using vertex_index_t = vertex_index_type<graph_t>;
+
+		const std::size_t V = graph.V.size();
+		assert(V <= std::numeric_limits<vertex_index_t>::max());
+		// 0 is undiscovered, [1, index) are active vertices, and completed components count down from V,
+		// which always stays above the active ones.
+		std::vector<vertex_index_t> rindex(V, 0);
+		std::vector<bool> root(V, false);
+		std::vector<vertex_index_t> scc_stack;
+		vertex_index_t index = 1, c = static_cast<vertex_index_t>(V);
+
+		struct discovered_t
+		{
+			std::vector<vertex_index_t> const& rindex;
+
+			void set(vertex_index_t) const noexcept
+			{
+			}
+			bool operator()(vertex_index_t v) const noexcept
+			{
+				return rindex[v] != 0;
+			}
+		} discovered{ rindex };
+		struct visitor_t
+		{
+			std::vector<vertex_index_t>& rindex;
+			std::vector<bool>& root;
+			std::vector<vertex_index_t>& scc_stack;
+			vertex_index_t& index, & c;
+
+			void discover_vertex(vertex_index_t v, vertex_index_t)
+			{
+				rindex[v] = index++;
+				root[v] = true;
+			}
+			// Edges to undiscovered vertices are accounted for in finish_vertex of their target.
+			void examine_edge(vertex_index_t v, out_edge_t const& edge)
+			{
+				if(rindex[edge.to] != 0 && rindex[edge.to] < rindex[v]) {
+					rindex[v] = rindex[edge.to];
+					root[v] = false;
+				}
+			}
+			void finish_vertex(vertex_index_t v, vertex_index_t parent)
+			{
+				if(root[v]) {
+					--index;
+					while(!scc_stack.empty() && rindex[v] <= rindex[scc_stack.back()]) {
+						rindex[scc_stack.back()] = c;
+						scc_stack.pop_back();
+						--index;
+					}
+					rindex[v] = c--;
+				} else {
+					scc_stack.push_back(v);
+				}
+				if(parent != v && rindex[v] < rindex[parent]) {
+					rindex[parent] = rindex[v];
+					root[parent] = false;
+				}
+			}
+		} visitor{ rindex, root, scc_stack, index, c };
+		std::vector<detail::dfs_compact_frame_type<graph_t const>> stack;
+		detail::basic_dfs_events(graph, std::views::iota(vertex_index_t(0), static_cast<vertex_index_t>(V)), visitor, discovered, stack);
+		stack = {};
+		scc_stack = {};
+
+		std::vector<std::size_t> result(V);
+		for(std::size_t v = 0; v < V; ++v)
+			result[v] = V - rindex[v];
+		return result;
+	}
+
+	namespace detail
+	{
+		// A bitmap whose bits can be claimed concurrently, like the visited marks of parallel_bfs_shortest_path.
+		class atomic_bitmap
+		{
+			static constexpr std::size_t word_bits = 64;
+			std::vector<std::atomic<std::uint64_t>> m_words;
+
+		public:
+			explicit atomic_bitmap(std::size_t n)
+			: m_words((n + word_bits - 1) / word_bits)
+			{
+			}
+
+			bool test(std::size_t index) const noexcept
+			{
+				return m_words[index / word_bits].load(std::memory_order_relaxed) >> (index % word_bits) & 1;
+			}
+			// Sets the bit and returns true iff it was not set before.
+			bool claim(std::size_t index) noexcept
+			{
+				std::atomic<std::uint64_t>& word = m_words[index / word_bits];
+				const std::uint64_t mask = std::uint64_t{1} << (index % word_bits);
+				// the relaxed load avoids most read-modify-writes on already set bits
+				return !(word.load(std::memory_order_relaxed) & mask) && !(word.fetch_or(mask, std::memory_order_relaxed) & mask);
+			}
+			void reset(std::size_t index) noexcept
+			{
+				m_words[index / word_bits].fetch_and(~(std::uint64_t{1} << (index % word_bits)), std::memory_order_relaxed);
+			}
+			void clear() noexcept
+			{
+				for(std::atomic<std::uint64_t>& word : m_words)
+					word.store(0, std::memory_order_relaxed);
+			}
+		};
+	}
+
+	// Multithreaded strongly connected components, in three steps that all run on pool:
+	// trimming repeatedly removes the vertices without remaining in- or out-neighbors as components of their own,
+	// then the component of the vertex with the most remaining neighbors is found as the backward closure from it
+	// within its forward closure (forward-backward), and finally coloring propagates the largest vertex index
+	// forward, so that every vertex whose color is its own index collects its component backward among its color.
+	// Coloring and trimming alternate until every vertex has a component.
+	// transposed shall be the transpose of graph, as used for the backward steps.
+	// Returns a vertex -> scc index mapping with indices in [0, number of components) like tarjan_recursive,
+	// the same partition, but numbered in an order that depends on scheduling.
+	template<typename graph_t, typename transposed_t>
+	std::vector<std::size_t> // vertex [0..V] -> scc index
+	parallel_strongly_connected_components(graph_t const& graph, transposed_t const& transposed, thread_pool& pool)
+	{
+		static_assert(is_directed_v<graph_t>, "strongly connected components exist in directed graphs");
+		using vertex_index_t = vertex_index_type<graph_t>;
+
+		const std::size_t V = graph.V.size();
+		assert(transposed.V.size() == V);
+		std::vector<std::size_t> component(V);
+		std::atomic<std::size_t> components = 0;
+		detail::atomic_bitmap done(V), forward(V), backward(V);
+		std::vector<std::atomic<vertex_index_t>> in_degree(V), out_degree(V), color(V);
+
+		// every thread collects into its own buffer, which are concatenated afterwards
+		std::vector<std::vector<vertex_index_t>> local(pool.size());
+		const auto gather = [&local](std::vector<vertex_index_t>& result){
+			result.clear();
+			for(std::vector<vertex_index_t>& buffer : local) {
+				result.insert(result.end(), buffer.begin(), buffer.end());
+				buffer.clear();
+			}
+		};
+		std::vector<vertex_index_t> active(V), frontier;
+		std::iota(active.begin(), active.end(), vertex_index_t(0));
+		const auto compact = [&]{
+			pool.for_each(active.size(), [&](std::size_t thread_index, std::size_t i){
+				if(!done.test(active[i]))
+					local[thread_index].push_back(active[i]);
+			});
+			gather(active);
+		};
+		// Expands frontier to everything reachable in g through the remaining vertices with allowed(from, to), claimed in marks.
+		const auto reach = [&](auto const& g, detail::atomic_bitmap& marks, auto allowed){
+			while(!frontier.empty()) {
+				pool.for_each(frontier.size(), [&](std::size_t thread_index, std::size_t i){
+					const vertex_index_t index = frontier[i];
+					for(auto const& out_edge : g.V[index].out_edges)
+						if(!done.test(out_edge.to) && allowed(index, out_edge.to) && marks.claim(out_edge.to))
+							local[thread_index].push_back(out_edge.to);
+				});
+				gather(frontier);
+			}
+		};
+
+		const auto trim = [&]{
+			pool.for_each(active.size(), [&](std::size_t thread_index, std::size_t i){
+				const vertex_index_t index = active[i];
+				vertex_index_t in = 0, out = 0;
+				for(auto const& out_edge : graph.V[index].out_edges)
+					out += !done.test(out_edge.to);
+				for(auto const& in_edge : transposed.V[index].out_edges)
+					in += !done.test(in_edge.to);
+				out_degree[index].store(out, std::memory_order_relaxed);
+				in_degree[index].store(in, std::memory_order_relaxed);
+				if(in == 0 || out == 0)
+					local[thread_index].push_back(index);
+			});
+			gather(frontier);
+			while(!frontier.empty()) {
+				// a vertex may be queued twice, once for each degree dropping to 0, but is claimed once
+				pool.for_each(frontier.size(), [&](std::size_t thread_index, std::size_t i){
+					const vertex_index_t index = frontier[i];
+					if(!done.claim(index))
+						return;
+					component[index] = components.fetch_add(1, std::memory_order_relaxed);
+					for(auto const& out_edge : graph.V[index].out_edges)
+						if(!done.test(out_edge.to) && in_degree[out_edge.to].fetch_sub(1, std::memory_order_relaxed) == 1)
+							local[thread_index].push_back(out_edge.to);
+					for(auto const& in_edge : transposed.V[index].out_edges)
+						if(!done.test(in_edge.to) && out_degree[in_edge.to].fetch_sub(1, std::memory_order_relaxed) == 1)
+							local[thread_index].push_back(in_edge.to);
+				});
+				gather(frontier);
+			}
+			compact();
+		};
+
+		trim();
+		if(!active.empty()) {
+			std::vector<std::pair<std::size_t, vertex_index_t>> best(pool.size(), { 0, active.front() });
+			pool.for_each(active.size(), [&](std::size_t thread_index, std::size_t i){
+				const vertex_index_t index = active[i];
+				const std::size_t score = (std::size_t(in_degree[index].load(std::memory_order_relaxed)) + 1) * (std::size_t(out_degree[index].load(std::memory_order_relaxed)) + 1);
+				best[thread_index] = std::max(best[thread_index], { score, index });
+			});
+			const vertex_index_t pivot = std::max_element(best.begin(), best.end())->second;
+
+			forward.claim(pivot);
+			frontier.assign(1, pivot);
+			reach(graph, forward, [](vertex_index_t, vertex_index_t){ return true; });
+			backward.claim(pivot);
+			frontier.assign(1, pivot);
+			reach(transposed, backward, [&forward](vertex_index_t, vertex_index_t to){ return forward.test(to); });
+			const std::size_t pivot_component = components.fetch_add(1, std::memory_order_relaxed);
+			pool.for_each(active.size(), [&](std::size_t, std::size_t i){
+				const vertex_index_t index = active[i];
+				if(backward.test(index)) {
+					component[index] = pivot_component;
+					done.claim(index);
+				}
+			});
+			compact();
+		}
+
+		while(!active.empty()) {
+			pool.for_each(active.size(), [&](std::size_t, std::size_t i){
+				color[active[i]].store(active[i], std::memory_order_relaxed);
+			});
+			// forward marks the vertices queued for the next round of propagation
+			forward.clear();
+			frontier = active;
+			while(!frontier.empty()) {
+				pool.for_each(frontier.size(), [&](std::size_t thread_index, std::size_t i){
+					const vertex_index_t index = frontier[i];
+					const vertex_index_t c = color[index].load(std::memory_order_relaxed);
+					for(auto const& out_edge : graph.V[index].out_edges)
+						if(!done.test(out_edge.to)) {
+							vertex_index_t previous = color[out_edge.to].load(std::memory_order_relaxed);
+							while(previous < c && !color[out_edge.to].compare_exchange_weak(previous, c, std::memory_order_relaxed))
+								;
+							if(previous < c && forward.claim(out_edge.to))
+								local[thread_index].push_back(out_edge.to);
+						}
+				});
+				gather(frontier);
+				for(vertex_index_t index : frontier)
+					forward.reset(index);
+			}
+
+			// every vertex that kept its own color is the root of a component among the vertices of its color
+			backward.clear();
+			pool.for_each(active.size(), [&](std::size_t thread_index, std::size_t i){
+				const vertex_index_t index = active[i];
+				if(color[index].load(std::memory_order_relaxed) == index) {
+					component[index] = components.fetch_add(1, std::memory_order_relaxed);
+					backward.claim(index);
+					local[thread_index].push_back(index);
+				}
+			});
+			gather(frontier);
+			reach(transposed, backward, [&color](vertex_index_t from, vertex_index_t to){
+				return color[to].load(std::memory_order_relaxed) == color[from].load(std::memory_order_relaxed);
+			});
+			pool.for_each(active.size(), [&](std::size_t, std::size_t i){
+				const vertex_index_t index = active[i];
+				const vertex_index_t root = color[index].load(std::memory_order_relaxed);
+				if(backward.test(index) && root != index)
+					component[index] = component[root];
+			});
+			pool.for_each(active.size(), [&](std::size_t, std::size_t i){
+				if(backward.test(active[i]))
+					done.claim(active[i]);
+			});
+			compact();
+			trim();
+		}
+		return component;
+	}
+	template<typename graph_t>
+	std::vector<std::size_t> parallel_strongly_connected_components(graph_t const& graph, thread_pool& pool)
+	{
+		return parallel_strongly_connected_components(graph, transpose(graph), pool);
+	}
+	template<typename graph_t>
+	std::vector<std::size_t> parallel_strongly_connected_components(graph_t const& graph)
+	{
+		thread_pool pool;
+		return parallel_strongly_connected_components(graph, pool);
+	}
+
+	// The condensation of a directed graph: one vertex per strongly connected component and an edge between two components
+	// iff some edge of the graph leads from the one to the other, so dag is acyclic and feeds straight into toposort_kahn.
+	template<typename index_t = vertex_index_t>
+	struct condensation
+	{
+		adjacency_list<directed, void, void, vector, vector, index_t> dag;
+		std::vector<std::size_t> component; // vertex [0..V] -> vertex of dag
+		std::vector<std::size_t> sizes; // vertex of dag -> number of vertices in its component
+		std::vector<std::vector<index_t>> members; // vertex of dag -> its vertices in ascending order, empty unless requested
+	};
+
+	// Builds the condensation from any vertex -> scc index mapping with indices in [0, number of components).
+	// The edges between components are deduplicated by the bulk construction of adjacency_list.
+	// time complexity:  O(E + V)
+	template<typename graph_t>
+	condensation<vertex_index_type<graph_t>> condense(graph_t const& graph, std::vector<std::size_t> component, bool with_members = false)
+	{
+		static_assert(is_directed_v<graph_t>, "strongly connected components exist in directed graphs");
+		using vertex_index_t = vertex_index_type<graph_t>;
+
+		const std::size_t V = graph.V.size();
+		assert(component.size() == V);
+		const std::size_t components = V == 0 ? 0 : *std::max_element(component.begin(), component.end()) + 1;
+
+		std::vector<std::pair<vertex_index_t, vertex_index_t>> edges;
+		for(vertex_index_t from = 0; from < V; ++from)
+			for(auto const& out_edge : graph.V[from].out_edges)
+				if(component[from] != component[out_edge.to])
+					edges.emplace_back(static_cast<vertex_index_t>(component[from]), static_cast<vertex_index_t>(component[out_edge.to]));
+
+		condensation<vertex_index_t> result{ { components, edges }, std::move(component), std::vector<std::size_t>(components, 0), {} };
+		for(std::size_t c : result.component)
+			++result.sizes[c];
+		if(with_members) {
+			result.members.resize(components);
+			for(std::size_t c = 0; c < components; ++c)
+				result.members[c].reserve(result.sizes[c]);
+			for(vertex_index_t index = 0; index < V; ++index)
+				result.members[result.component[index]].push_back(index);
+		}
+		return result;
+	}
+	// Components are numbered as by pearce_iterative, in reverse topological order: every edge of dag leads to a smaller index.
+	template<typename graph_t>
+	condensation<vertex_index_type<graph_t>> condense(graph_t const& graph, bool with_members = false)
+	{
+		return condense(graph, pearce_iterative(graph), with_members);
+	}
 }
 
 #endif // !QUIVER_STRONGLY_CONNECTED_COMPONENTS_HPP_INCLUDED
@@ -0,0 +1,147 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_THREAD_POOL_HPP_INCLUDED
+#define QUIVER_THREAD_POOL_HPP_INCLUDED
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <type_traits>
+#include <cstddef>
+
+namespace quiver
+{
+	// A fixed set of worker threads that execute one job at a time.
+	// The thread calling run or for_each takes part in the job as thread 0,
+	// so a pool of size 1 has no worker threads at all.
+	// Jobs must not call run or for_each of the pool executing them.
+	class thread_pool
+	{
+		std::vector<std::thread> m_workers;
+		std::mutex m_mutex;
+		std::condition_variable m_start, m_finish;
+		void (*m_invoke)(void*, std::size_t) = nullptr;
+		void* m_job = nullptr;
+		std::size_t m_generation = 0;
+		std::size_t m_running = 0;
+		bool m_stop = false;
+		std::exception_ptr m_exception;
+
+		void execute(std::size_t thread_index) noexcept
+		{
+			try {
+				m_invoke(m_job, thread_index);
+			} catch(...) {
+				std::lock_guard lock(m_mutex);
+				if(!m_exception)
+					m_exception = std::current_exception();
+			}
+		}
+		void work(std::size_t thread_index) noexcept
+		{
+			for(std::size_t generation = 0;;) {
+				{
+					std::unique_lock lock(m_mutex);
+					m_start.wait(lock, [&]{ return m_stop || m_generation != generation; });
+					if(m_stop)
+						return;
+					generation = m_generation;
+				}
+				execute(thread_index);
+				{
+					std::lock_guard lock(m_mutex);
+					if(--m_running == 0)
+						m_finish.notify_one();
+				}
+			}
+		}
+
+	public:
+		static std::size_t default_size() noexcept
+		{
+			return std::max(std::thread::hardware_concurrency(), 1u);
+		}
+
+		explicit thread_pool(std::size_t threads = default_size())
+		{
+			m_workers.reserve(threads > 0 ? threads - 1 : 0);
+			for(std::size_t i = 1; i < threads; ++i)
+				m_workers.emplace_back(&thread_pool::work, this, i);
+		}
+		thread_pool(thread_pool const&) = delete;
+		thread_pool& operator=(thread_pool const&) = delete;
+		~thread_pool()
+		{
+			{
+				std::lock_guard lock(m_mutex);
+				m_stop = true;
+			}
+			m_start.notify_all();
+			for(std::thread& worker : m_workers)
+				worker.join();
+		}
+
+		std::size_t size() const noexcept
+		{
+			return m_workers.size() + 1;
+		}
+
+		// Invokes job(thread_index) once on every thread of the pool, thread_index in [0, size()).
+		// Blocks until all invocations have returned and rethrows the first exception thrown by any of them.
+		template<typename job_t>
+		void run(job_t&& job)
+		{
+			m_invoke = [](void* job, std::size_t thread_index){ (*static_cast<std::remove_reference_t<job_t>*>(job))(thread_index); };
+			m_job = const_cast<void*>(static_cast<void const*>(std::addressof(job)));
+			{
+				std::lock_guard lock(m_mutex);
+				m_running = m_workers.size();
+				++m_generation;
+			}
+			m_start.notify_all();
+			execute(0);
+			std::exception_ptr exception;
+			{
+				std::unique_lock lock(m_mutex);
+				m_finish.wait(lock, [&]{ return m_running == 0; });
+				std::swap(exception, m_exception);
+			}
+			if(exception)
+				std::rethrow_exception(exception);
+		}
+
+		// Invokes job(thread_index, i) for every i in [0, count), distributing chunks of indices dynamically.
+		template<typename job_t>
+		void for_each(std::size_t count, job_t&& job)
+		{
+			if(count == 0)
+				return;
+			if(size() == 1 || count == 1) {
+				for(std::size_t i = 0; i < count; ++i)
+					job(std::size_t{0}, i);
+				return;
+			}
+			const std::size_t chunk = std::max<std::size_t>(count / (8 * size()), 1);
+			std::atomic<std::size_t> next = 0;
+			run([&](std::size_t thread_index){
+				for(std::size_t begin; (begin = next.fetch_add(chunk, std::memory_order_relaxed)) < count;) {
+					const std::size_t end = std::min(begin + chunk, count);
+					for(std::size_t i = begin; i < end; ++i)
+						job(thread_index, i);
+				}
+			});
+		}
+	};
+}
+
+#endif // !QUIVER_THREAD_POOL_HPP_INCLUDED
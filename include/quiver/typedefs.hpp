@@ -13,8 +13,12 @@
 
 namespace quiver
 {
+	// The default vertex index type. Graph types carry their own as graph_t::vertex_index_t.
 	using vertex_index_t = std::size_t;
 
+	template<typename graph_t>
+	using vertex_index_type = typename graph_t::vertex_index_t;
+
 	enum directivity_t
 	{
 		directed,
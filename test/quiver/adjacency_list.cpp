@@ -124,4 +124,80 @@ TEST_CASE("adjacency_list", "[quiver]")
 			CHECK(graph.E(2, 6) != nullptr);
 		}
 	}
+	SECTION("32-bit vertex indices")
+	{
+		using graph_t = adjacency_list<undirected, wt<float>, void, vector, vector, std::uint32_t>;
+		using wide_graph_t = adjacency_list<undirected, wt<float>, void>;
+		CHECK(std::is_same_v<vertex_index_type<graph_t>, std::uint32_t>);
+		CHECK(sizeof(graph_t::out_edge_t) == 8);
+		CHECK(sizeof(graph_t::out_edge_t) < sizeof(wide_graph_t::out_edge_t));
+
+		graph_t graph(5);
+		CHECK(graph.V.emplace() == 5);
+		CHECK(graph.E.emplace(0, 1, 1.0f));
+		CHECK(graph.E.emplace(1, 2, 2.0f));
+		CHECK(graph.E.emplace(0, 2, 4.0f));
+		CHECK(graph.E.emplace(3, 4, 1.0f));
+		CHECK(!graph.E.emplace(2, 1, 0.0f));
+		CHECK(graph.E.size() == 4);
+		CHECK(ccs(graph) == 3);
+		CHECK(split_ccs(graph).size() == 3);
+
+		const auto shortest_path = dijkstra_shortest_path(graph, 0);
+		using pair_t = decltype(shortest_path)::value_type;
+		CHECK(std::is_same_v<pair_t::second_type, std::uint32_t>);
+		CHECK(shortest_path[2] == pair_t(3.0f, 1));
+		CHECK(shortest_path[4].second == ~std::uint32_t{});
+
+		const auto bfs_path = bfs_shortest_path(graph, 0);
+		CHECK(bfs_path[2].first == 1);
+		CHECK(bfs_path[2].second == 0);
+
+		const auto mst = kruskal(graph);
+		CHECK(mst.E.size() == 3);
+		CHECK(mst.E(0, 2) == nullptr);
+	}
+	SECTION("bulk construction")
+	{
+		SECTION("directed")
+		{
+			using graph_t = adjacency_list<directed, wt<int>, void>;
+			const std::vector<std::tuple<vertex_index_t, vertex_index_t, int>> edges = {
+				{ 0, 1, 3 }, { 1, 2, 4 }, { 0, 1, 5 }, { 2, 0, 6 }, { 1, 0, 7 }, { 0, 2, 8 },
+			};
+			const graph_t graph(3, edges);
+			CHECK(graph.V.size() == 3);
+			CHECK(graph.E.size() == 5);
+			REQUIRE(graph.E(0, 1) != nullptr);
+			CHECK(graph.E(0, 1)->weight == 3);
+			REQUIRE(graph.E(1, 0) != nullptr);
+			CHECK(graph.E(1, 0)->weight == 7);
+			REQUIRE(graph.V[0].out_degree() == 2);
+			CHECK(graph.V[0].out_edges[0].to == 1);
+			CHECK(graph.V[0].out_edges[1].to == 2);
+		}
+		SECTION("undirected")
+		{
+			using graph_t = adjacency_list<undirected, wt<int>, void>;
+			const std::vector<graph_t::edge_t> edges = {
+				{ 0, 1, 3 }, { 2, 1, 4 }, { 1, 0, 5 }, { 3, 0, 6 },
+			};
+			const graph_t graph(4, edges);
+			CHECK(graph.E.size() == 3);
+			CHECK(graph.degree(0) == 2);
+			CHECK(graph.degree(1) == 2);
+			REQUIRE(graph.E(1, 0) != nullptr);
+			CHECK(graph.E(1, 0)->weight == 3);
+			CHECK(graph.E(0, 1)->weight == 3);
+			REQUIRE(graph.E(1, 2) != nullptr);
+			CHECK(graph.E(1, 2)->weight == 4);
+		}
+		SECTION("unweighted")
+		{
+			const std::vector<std::pair<vertex_index_t, vertex_index_t>> edges = { { 0, 1 }, { 1, 2 }, { 2, 0 } };
+			const adjacency_list<undirected> graph(3, edges);
+			CHECK(graph.E.size() == 3);
+			CHECK(is_regular(graph, 2));
+		}
+	}
 }
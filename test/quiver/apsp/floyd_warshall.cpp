@@ -0,0 +1,123 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include "../random_graphs.hpp"
+#include <algorithm>
+#include <vector>
+#include <random>
+#include <span>
+
+TEST_CASE("floyd_warshall", "[quiver][apsp]")
+{
+	// more than two blocks, the last one partial
+	const std::size_t V = 150;
+	thread_pool pool(3);
+
+	SECTION("negative weights")
+	{
+		std::mt19937 engine(19);
+		std::uniform_int_distribution<int> potential_distribution(0, 50);
+		std::vector<int> potential(V);
+		for(int& p : potential)
+			p = potential_distribution(engine);
+		const auto graph = shifted_by_potential(random_graph<adjacency_list<directed, wt<int>>>(V, 6 * V, std::uniform_int_distribution<int>(0, 20), 19), potential);
+		const auto expected = johnson_all_pairs(graph, pool);
+		const auto matrix = floyd_warshall(graph, pool);
+		REQUIRE(matrix.rows() == V);
+		REQUIRE(matrix.columns() == V);
+		CHECK(std::ranges::equal(matrix.data(), expected.data()));
+
+		const auto [distances, predecessors] = floyd_warshall_shortest_path(graph, pool);
+		CHECK(std::ranges::equal(distances.data(), expected.data()));
+		for(vertex_index_t source = 0; source < V; ++source)
+			for(vertex_index_t target = 0; target < V; ++target) {
+				if(distances(source, target) == inf<int>) {
+					CHECK(predecessors[source * V + target] == ~vertex_index_t{});
+					continue;
+				}
+				// walk the predecessors back, summing the cheapest edges
+				int length = 0;
+				std::size_t steps = 0;
+				for(vertex_index_t index = target; index != source && steps <= V; ++steps) {
+					const vertex_index_t predecessor = predecessors[source * V + index];
+					REQUIRE(predecessor < V);
+					int weight = inf<int>;
+					for(auto const& edge : graph.V[predecessor].out_edges)
+						if(edge.to == index)
+							weight = std::min(weight, edge.weight);
+					REQUIRE(weight != inf<int>);
+					length += weight;
+					index = predecessor;
+				}
+				REQUIRE(steps <= V);
+				CHECK(length == distances(source, target));
+			}
+	}
+	SECTION("complete")
+	{
+		const auto graph = complete(V);
+		const auto weight = [](vertex_index_t from, auto const& edge) -> float {
+			return static_cast<float>((from + edge.to + from * edge.to) % 97 + 1);
+		};
+		const auto matrix = floyd_warshall(graph, weight, pool);
+		for(vertex_index_t source = 0; source < V; source += 7) {
+			const auto expected = dijkstra_shortest_path(graph, source, weight);
+			for(vertex_index_t target = 0; target < V; ++target)
+				CHECK(matrix(source, target) == expected[target].first);
+		}
+	}
+	SECTION("in place")
+	{
+		std::mt19937 engine(5);
+		std::uniform_real_distribution<double> weight_distribution(1, 10);
+		std::bernoulli_distribution edge_distribution(0.1);
+		adjacency_list<directed, wt<double>> graph(V);
+		std::vector<double> distances(V * V, floyd_warshall_inf<double>);
+		for(vertex_index_t from = 0; from < V; ++from) {
+			distances[from * V + from] = 0;
+			for(vertex_index_t to = 0; to < V; ++to)
+				if(from != to && edge_distribution(engine)) {
+					const double w = weight_distribution(engine);
+					graph.E.emplace(from, to, w);
+					distances[from * V + to] = w;
+				}
+		}
+		floyd_warshall_in_place(std::span(distances), V, pool);
+		for(vertex_index_t source = 0; source < V; source += 11) {
+			const auto expected = dijkstra_shortest_path(graph, source);
+			for(vertex_index_t target = 0; target < V; ++target)
+				CHECK(distances[source * V + target] == Approx(expected[target].first));
+		}
+	}
+	SECTION("unreachable")
+	{
+		adjacency_list<directed, wt<int>> graph(3);
+		graph.E.emplace(0, 1, -2);
+		const auto matrix = floyd_warshall(graph);
+		CHECK(matrix(0, 1) == -2);
+		CHECK(matrix(1, 0) == inf<int>);
+		CHECK(matrix(0, 2) == inf<int>);
+		CHECK(matrix(2, 2) == 0);
+		CHECK(floyd_warshall(adjacency_list<directed, wt<int>>()).rows() == 0);
+	}
+	SECTION("negative cycle")
+	{
+		adjacency_list<directed, wt<int>> cyclic(3);
+		cyclic.E.emplace(0, 1, 1);
+		cyclic.E.emplace(1, 2, -3);
+		cyclic.E.emplace(2, 0, 1);
+		try {
+			(void)floyd_warshall(cyclic);
+			FAIL("no exception");
+		} catch(negative_cycle const& e) {
+			CHECK(e.cycle.size() == 3);
+		}
+	}
+}
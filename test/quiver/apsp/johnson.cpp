@@ -0,0 +1,66 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include "../random_graphs.hpp"
+#include <atomic>
+#include <vector>
+#include <random>
+#include <span>
+
+TEST_CASE("johnson", "[quiver][apsp]")
+{
+	// a potential keeps the cycles non-negative while many edges are negative
+	std::mt19937 engine(21);
+	const std::size_t V = 120;
+	std::uniform_int_distribution<int> potential_distribution(0, 50);
+	std::vector<int> potential(V);
+	for(int& p : potential)
+		p = potential_distribution(engine);
+	const auto graph = shifted_by_potential(random_graph<adjacency_list<directed, wt<int>>>(V, 4 * V, std::uniform_int_distribution<int>(0, 20), 21), potential);
+	thread_pool pool(3);
+
+	SECTION("matrix")
+	{
+		const auto matrix = johnson_all_pairs(graph, pool);
+		REQUIRE(matrix.rows() == V);
+		REQUIRE(matrix.columns() == V);
+		for(vertex_index_t source = 0; source < V; source += 7) {
+			const auto expected = bellman_ford_shortest_path(graph, source);
+			for(vertex_index_t target = 0; target < V; ++target)
+				CHECK(matrix(source, target) == expected[target].first);
+		}
+
+		std::vector<int> span_matrix(V * V);
+		johnson_all_pairs(graph, std::span(span_matrix), dijkstra_default_weight_invokable<decltype(graph)>(), pool);
+		CHECK(std::ranges::equal(span_matrix, matrix.data()));
+	}
+	SECTION("rows")
+	{
+		std::vector<std::atomic<int>> calls(V);
+		std::atomic<bool> mismatch = false;
+		const auto expected = johnson_all_pairs(graph);
+		johnson_all_pairs(graph, dijkstra_default_weight_invokable<decltype(graph)>(), pool, [&](vertex_index_t source, std::span<int const> row){
+			++calls[source];
+			if(!std::ranges::equal(row, expected.row(source)))
+				mismatch = true;
+		});
+		for(auto const& count : calls)
+			CHECK(count == 1);
+		CHECK(!mismatch);
+	}
+	SECTION("negative cycle")
+	{
+		adjacency_list<directed, wt<int>> cyclic(3);
+		cyclic.E.emplace(0, 1, 1);
+		cyclic.E.emplace(1, 2, -3);
+		cyclic.E.emplace(2, 0, 1);
+		CHECK_THROWS_AS(johnson_all_pairs(cyclic), negative_cycle);
+	}
+}
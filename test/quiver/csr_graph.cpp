@@ -0,0 +1,104 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include <vector>
+
+TEST_CASE("csr_graph", "[quiver]")
+{
+	SECTION("directed")
+	{
+		using graph_t = adjacency_list<directed, wt<int>, void>;
+		graph_t graph(5);
+		graph.E.emplace(0, 3, 3);
+		graph.E.emplace(1, 2, 5);
+		graph.E.emplace(1, 4, 1);
+		graph.E.emplace(2, 0, 0);
+		graph.E.emplace(3, 2, 2);
+		graph.E.emplace(4, 0, 6);
+		graph.E.emplace(4, 3, 1);
+
+		const auto frozen = freeze(graph);
+		CHECK(is_directed_v<decltype(frozen)> == true);
+		CHECK(is_weighted_v<decltype(frozen)> == true);
+		REQUIRE(frozen.V.size() == graph.V.size());
+		REQUIRE(frozen.E.size() == graph.E.size());
+		for(vertex_index_t v = 0; v < graph.V.size(); ++v) {
+			REQUIRE(frozen.V[v].out_degree() == graph.V[v].out_degree());
+			CHECK(frozen.in_degree(v) == graph.in_degree(v));
+		}
+		REQUIRE(frozen.E(1, 4) != nullptr);
+		CHECK(frozen.E(1, 4)->weight == 1);
+		CHECK(frozen.E(4, 1) == nullptr);
+
+		CHECK(bfs_shortest_path(frozen, 1) == bfs_shortest_path(graph, 1));
+		CHECK(dijkstra_shortest_path(frozen, 1) == dijkstra_shortest_path(graph, 1));
+
+		std::vector<vertex_index_t> visited, frozen_visited;
+		dfs(graph, 1, [&](vertex_index_t v){ visited.push_back(v); return false; });
+		dfs(frozen, 1, [&](vertex_index_t v){ frozen_visited.push_back(v); return false; });
+		CHECK(visited == frozen_visited);
+
+		CHECK(tarjan_recursive(frozen) == tarjan_recursive(graph));
+
+		const auto copy = frozen;
+		CHECK(copy.E(4, 0)->weight == 6);
+		CHECK(copy.V[4].out_edges.data() != frozen.V[4].out_edges.data());
+
+		const graph_t thawed = thaw(frozen);
+		REQUIRE(thawed.V.size() == graph.V.size());
+		CHECK(thawed.E.size() == graph.E.size());
+		for(vertex_index_t v = 0; v < graph.V.size(); ++v) {
+			REQUIRE(thawed.V[v].out_degree() == graph.V[v].out_degree());
+			for(std::size_t i = 0; i < graph.V[v].out_degree(); ++i) {
+				CHECK(thawed.V[v].out_edges[i].to == graph.V[v].out_edges[i].to);
+				CHECK(thawed.V[v].out_edges[i].weight == graph.V[v].out_edges[i].weight);
+			}
+		}
+	}
+	SECTION("undirected")
+	{
+		using graph_t = adjacency_list<undirected, wt<int>, void>;
+		graph_t graph(6);
+		graph.E.emplace(0, 1, 1);
+		graph.E.emplace(0, 2, 3);
+		graph.E.emplace(0, 3, 3);
+		graph.E.emplace(1, 2, 2);
+		graph.E.emplace(2, 3, 4);
+		graph.E.emplace(2, 5, 7);
+		graph.E.emplace(3, 4, 1);
+		graph.E.emplace(4, 5, 9);
+
+		const csr_graph<undirected, wt<int>> frozen(graph);
+		CHECK(frozen.E.size() == graph.E.size());
+		CHECK(frozen.degree(2) == 4);
+		REQUIRE(frozen.E(5, 2) != nullptr);
+		CHECK(frozen.E(5, 2)->weight == 7);
+
+		const graph_t mst = kruskal(frozen);
+		REQUIRE(mst.V.size() == graph.V.size());
+		REQUIRE(mst.E.size() == graph.V.size() - 1);
+		CHECK(mst.E(0, 1) != nullptr);
+		CHECK(mst.E(0, 3) != nullptr);
+		CHECK(mst.E(1, 2) != nullptr);
+		CHECK(mst.E(2, 5) != nullptr);
+		CHECK(mst.E(3, 4) != nullptr);
+
+		CHECK(thaw(frozen).E.size() == graph.E.size());
+	}
+	SECTION("toposort")
+	{
+		adjacency_list<directed> graph(4);
+		graph.E.emplace(3, 1);
+		graph.E.emplace(1, 0);
+		graph.E.emplace(1, 2);
+		graph.E.emplace(2, 0);
+		CHECK(toposort_kahn(freeze(graph)) == toposort_kahn(graph));
+	}
+}
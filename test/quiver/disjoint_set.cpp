@@ -8,6 +8,11 @@
 #include <catch2/catch.hpp>
 #include <quiver.hpp>
 using namespace quiver;
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
 
 TEST_CASE("disjoint_set", "[quiver][fundamentals]")
 {
@@ -69,3 +74,47 @@ TEST_CASE("disjoint_set", "[quiver][fundamentals]")
 	CHECK(set.find(1) == set.find(7));
 	CHECK(set.find(1) == set.find(9));
 }
+
+TEST_CASE("concurrent_disjoint_set", "[quiver][fundamentals]")
+{
+	const std::size_t N = 20000;
+	std::mt19937 engine(25);
+	std::uniform_int_distribution<std::uint32_t> distribution(0, N - 1);
+	std::vector<std::pair<std::uint32_t, std::uint32_t>> pairs(N);
+	for(auto& [a, b] : pairs) {
+		a = distribution(engine);
+		b = distribution(engine);
+	}
+
+	disjoint_set<path_splitting, std::uint32_t> expected(N);
+	for(auto const& [a, b] : pairs)
+		expected.unite(a, b);
+
+	thread_pool pool(4);
+	concurrent_disjoint_set<std::uint32_t> set(N);
+	CHECK(set.sets() == N);
+	CHECK(set.size() == N);
+	// half of the unions run alongside queries about the other half
+	std::atomic<std::size_t> united = 0;
+	pool.for_each(N, [&](std::size_t, std::size_t i){
+		auto const& [a, b] = pairs[i];
+		if(i % 2 == 0)
+			united += set.unite(a, b);
+		else if(!set.same_set(a, b))
+			united += set.unite(b, a);
+	});
+	CHECK(united == N - expected.sets());
+	CHECK(set.sets() == expected.sets());
+	for(std::uint32_t i = 0; i < N; ++i) {
+		CHECK(set.same_set(i, pairs[i].first) == expected.same_set(i, pairs[i].first));
+		CHECK((set.find(i) == set.find(pairs[i].second)) == expected.same_set(i, pairs[i].second));
+	}
+
+	set.reset(3);
+	CHECK(set.sets() == 3);
+	CHECK(set.unite(0, 2));
+	CHECK(!set.unite(2, 0));
+	CHECK(set.same_set(0, 2));
+	CHECK(!set.same_set(1, 2));
+	CHECK(set.sets() == 2);
+}
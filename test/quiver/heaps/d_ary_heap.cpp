@@ -0,0 +1,64 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include <vector>
+#include <random>
+#include <algorithm>
+
+TEST_CASE("d_ary_heap", "[quiver][heaps]")
+{
+	std::mt19937 engine(42);
+	std::uniform_int_distribution<int> distribution(0, 100);
+	std::vector<int> values(500);
+	for(int& value : values)
+		value = distribution(engine);
+
+	quaternary_heap<int> heap;
+	octonary_heap<int> heap2;
+	for(std::size_t i = 0; i < values.size() / 2; ++i)
+		heap.push(values[i]);
+	for(std::size_t i = values.size() / 2; i < values.size(); ++i)
+		heap2.push(values[i]);
+	CHECK(heap.size() == values.size() / 2);
+	CHECK(heap.top() == *std::min_element(values.begin(), values.begin() + values.size() / 2));
+
+	SECTION("extract")
+	{
+		std::vector<int> sorted(values.begin(), values.begin() + values.size() / 2);
+		std::sort(sorted.begin(), sorted.end());
+		for(int value : sorted)
+			CHECK(heap.extract_top() == value);
+		CHECK(heap.empty());
+	}
+	SECTION("merge")
+	{
+		d_ary_heap<int, 4> merged;
+		merged.merge(heap);
+		d_ary_heap<int, 4> other;
+		while(!heap2.empty())
+			other.push(heap2.extract_top());
+		merged.merge(std::move(other));
+
+		std::sort(values.begin(), values.end());
+		for(int value : values)
+			CHECK(merged.extract_top() == value);
+		CHECK(merged.empty());
+	}
+	SECTION("update")
+	{
+		const std::size_t index = heap.push(-1);
+		CHECK(heap.top() == -1);
+		CHECK(heap.get(index) == -1);
+		heap.increase(index, 1000);
+		CHECK(heap.top() != -1);
+		heap.erase(heap.size() - 1);
+		CHECK(heap.size() == values.size() / 2);
+	}
+}
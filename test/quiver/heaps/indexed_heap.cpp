@@ -0,0 +1,70 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include <vector>
+#include <random>
+#include <algorithm>
+
+TEST_CASE("indexed_heap", "[quiver][heaps]")
+{
+	indexed_heap<int> heap(6);
+	heap.push(0, 5);
+	heap.push(3, 2);
+	heap.push(5, 7);
+	CHECK(heap.size() == 3);
+	CHECK(heap.contains(3));
+	CHECK(!heap.contains(1));
+	CHECK(heap.key(5) == 7);
+	CHECK(heap.top() == std::pair(2, std::size_t(3)));
+
+	heap.decrease(5, 1);
+	CHECK(heap.top() == std::pair(1, std::size_t(5)));
+	CHECK(heap.push_or_decrease(0, 9) == false);
+	CHECK(heap.key(0) == 5);
+	CHECK(heap.push_or_decrease(0, 0) == true);
+	CHECK(heap.push_or_decrease(1, 4) == true);
+	CHECK(heap.size() == 4);
+
+	heap.erase(3);
+	CHECK(!heap.contains(3));
+	CHECK(heap.extract_top() == std::pair(0, std::size_t(0)));
+	CHECK(heap.extract_top() == std::pair(1, std::size_t(5)));
+	CHECK(heap.extract_top() == std::pair(4, std::size_t(1)));
+	CHECK(heap.empty());
+	CHECK(!heap.contains(0));
+
+	SECTION("random")
+	{
+		std::mt19937 engine(42);
+		std::uniform_int_distribution<int> key_distribution(0, 1000);
+		std::uniform_int_distribution<std::size_t> index_distribution(0, 99);
+		std::vector<int> keys(100, -1);
+		indexed_heap<int> random_heap(keys.size());
+		for(int i = 0; i < 1000; ++i) {
+			const std::size_t index = index_distribution(engine);
+			const int key = key_distribution(engine);
+			random_heap.push_or_decrease(index, key);
+			if(keys[index] == -1 || key < keys[index])
+				keys[index] = key;
+		}
+		CHECK(random_heap.size() == keys.size() - std::count(keys.begin(), keys.end(), -1));
+		int previous = -1;
+		while(!random_heap.empty()) {
+			const auto [key, index] = random_heap.extract_top();
+			CHECK(key == keys[index]);
+			CHECK(previous <= key);
+			previous = key;
+		}
+
+		random_heap.push(7, 3);
+		random_heap.clear();
+		CHECK(!random_heap.contains(7));
+	}
+}
@@ -0,0 +1,57 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include <vector>
+#include <random>
+#include <algorithm>
+
+TEST_CASE("radix_heap", "[quiver][heaps]")
+{
+	radix_heap<unsigned> heap;
+	heap.push(5u);
+	heap.push(1u);
+	heap.push(9u);
+	heap.push(1u);
+	CHECK(heap.size() == 4);
+	CHECK(heap.top() == 1);
+	CHECK(heap.extract_top() == 1);
+	CHECK(heap.last_key() == 1);
+	heap.push(3u);
+	CHECK(heap.extract_top() == 1);
+	CHECK(heap.extract_top() == 3);
+	heap.push(3u);
+	CHECK(heap.extract_top() == 3);
+	CHECK(heap.extract_top() == 5);
+	CHECK(heap.extract_top() == 9);
+	CHECK(heap.empty());
+
+	SECTION("monotone sequence")
+	{
+		std::mt19937 engine(42);
+		std::uniform_int_distribution<unsigned> distribution(0, 1000);
+		radix_heap<std::size_t> monotone;
+		min_heap<std::size_t> reference;
+		for(int i = 0; i < 50; ++i) {
+			const std::size_t value = distribution(engine);
+			monotone.push(value);
+			reference.push(value);
+		}
+		while(!reference.empty()) {
+			const std::size_t top = reference.extract_top();
+			REQUIRE(monotone.extract_top() == top);
+			if(distribution(engine) % 2) {
+				const std::size_t value = top + distribution(engine);
+				monotone.push(value);
+				reference.push(value);
+			}
+		}
+		CHECK(monotone.empty());
+	}
+}
@@ -0,0 +1,93 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_TEST_RANDOM_GRAPHS_HPP_INCLUDED
+#define QUIVER_TEST_RANDOM_GRAPHS_HPP_INCLUDED
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <random>
+#include <vector>
+#include <tuple>
+
+// edges random (from, to) pairs without loops, possibly repeated.
+inline std::vector<std::pair<quiver::vertex_index_t, quiver::vertex_index_t>> random_edges(std::size_t V, std::size_t edges, std::mt19937::result_type seed)
+{
+	std::mt19937 engine(seed);
+	std::uniform_int_distribution<quiver::vertex_index_t> vertex_distribution(0, V - 1);
+	std::vector<std::pair<quiver::vertex_index_t, quiver::vertex_index_t>> result;
+	result.reserve(edges);
+	for(std::size_t i = 0; i < edges; ++i) {
+		const quiver::vertex_index_t from = vertex_distribution(engine), to = vertex_distribution(engine);
+		if(from != to)
+			result.emplace_back(from, to);
+	}
+	return result;
+}
+
+// A graph_t on V vertices from edges random edges, of which loops and repeated edges are dropped.
+template<typename graph_t>
+graph_t random_graph(std::size_t V, std::size_t edges, std::mt19937::result_type seed)
+{
+	return graph_t(V, random_edges(V, edges, seed));
+}
+// Same as above, with every edge weighted by weights(engine), e.g. a distribution.
+// Weights are drawn for dropped edges as well, so graphs of either directivity from the same seed share their edges and weights.
+template<typename graph_t, typename weights_t>
+graph_t random_graph(std::size_t V, std::size_t edges, weights_t weights, std::mt19937::result_type seed)
+{
+	using weight_t = decltype(std::declval<typename graph_t::out_edge_t>().weight);
+	std::mt19937 engine(seed);
+	std::uniform_int_distribution<quiver::vertex_index_t> vertex_distribution(0, V - 1);
+	std::vector<std::tuple<quiver::vertex_index_t, quiver::vertex_index_t, weight_t>> result;
+	result.reserve(edges);
+	for(std::size_t i = 0; i < edges; ++i) {
+		const quiver::vertex_index_t from = vertex_distribution(engine), to = vertex_distribution(engine);
+		const weight_t weight = static_cast<weight_t>(weights(engine));
+		if(from != to)
+			result.emplace_back(from, to, weight);
+	}
+	return graph_t(V, result);
+}
+
+// A copy of graph with the weight of every edge from -> to changed by potential[from] - potential[to].
+// Every cycle keeps its weight, so non-negative graphs turn into ones with negative edges but no negative cycles.
+template<typename graph_t, typename potential_t>
+graph_t shifted_by_potential(graph_t const& graph, std::vector<potential_t> const& potential)
+{
+	std::vector<std::tuple<quiver::vertex_index_t, quiver::vertex_index_t, decltype(graph.V[0].out_edges[0].weight)>> edges;
+	for(quiver::vertex_index_t from = 0; from < graph.V.size(); ++from)
+		for(auto const& edge : graph.V[from].out_edges)
+			edges.emplace_back(from, edge.to, edge.weight + potential[from] - potential[edge.to]);
+	return graph_t(graph.V.size(), edges);
+}
+
+// Checks that path leads from source to target along edges of graph whose edge_length(edge) add up to distance.
+template<typename graph_t, typename distance_t, typename edge_length_t>
+void check_path(graph_t const& graph, quiver::vertex_index_t source, quiver::vertex_index_t target, std::vector<quiver::vertex_index_t> const& path, distance_t const& distance, edge_length_t edge_length)
+{
+	REQUIRE(!path.empty());
+	CHECK(path.front() == source);
+	CHECK(path.back() == target);
+	distance_t length = 0;
+	for(std::size_t i = 1; i < path.size(); ++i) {
+		auto const* edge = graph.E(path[i - 1], path[i]);
+		REQUIRE(edge != nullptr);
+		length += edge_length(*edge);
+	}
+	CHECK(length == distance);
+}
+template<typename graph_t, typename distance_t>
+void check_path(graph_t const& graph, quiver::vertex_index_t source, quiver::vertex_index_t target, std::vector<quiver::vertex_index_t> const& path, distance_t const& distance)
+{
+	check_path(graph, source, target, path, distance, [](auto const& edge){ return edge.weight; });
+}
+
+#endif // !QUIVER_TEST_RANDOM_GRAPHS_HPP_INCLUDED
@@ -0,0 +1,128 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include "../random_graphs.hpp"
+#include <vector>
+#include <type_traits>
+#include <cstdint>
+#include <tuple>
+#include <random>
+#include <cstdlib>
+
+namespace
+{
+	struct point
+	{
+		int x, y;
+	};
+}
+
+TEST_CASE("astar", "[quiver][search]")
+{
+	// a grid whose vertices carry their coordinates, with weights of at least 1 per step
+	const int width = 20, height = 15;
+	std::mt19937 engine(42);
+	std::uniform_int_distribution<int> weight_distribution(1, 9);
+	using graph_t = adjacency_list<undirected, wt<int>, point>;
+	graph_t graph;
+	for(int y = 0; y < height; ++y)
+		for(int x = 0; x < width; ++x)
+			graph.V.emplace(point{ x, y });
+	for(int y = 0; y < height; ++y)
+		for(int x = 0; x < width; ++x) {
+			const vertex_index_t index = y * width + x;
+			if(x + 1 < width && weight_distribution(engine) != 9)
+				graph.E.emplace(index, index + 1, weight_distribution(engine));
+			if(y + 1 < height && weight_distribution(engine) != 9)
+				graph.E.emplace(index, index + width, weight_distribution(engine));
+		}
+
+	const auto manhattan = [&graph](vertex_index_t goal){
+		return [&graph, goal](vertex_index_t index){
+			return std::abs(graph.V[index].x - graph.V[goal].x) + std::abs(graph.V[index].y - graph.V[goal].y);
+		};
+	};
+
+	const vertex_index_t start = 0;
+	const auto expected = dijkstra_shortest_path(graph, start);
+	for(vertex_index_t goal : { 0, 19, 150, 299 }) {
+		const auto [distance, path] = astar_shortest_path(graph, start, goal, manhattan(goal));
+		CHECK(distance == expected[goal].first);
+		if(expected[goal].first == inf<int>) {
+			CHECK(path.empty());
+			continue;
+		}
+		check_path(graph, start, goal, path, distance);
+	}
+
+	SECTION("heaps and workspace")
+	{
+		search_workspace workspace(graph);
+		for(vertex_index_t goal : { 0, 19, 150, 299, 150 }) {
+			const auto radix = astar_shortest_path<radix_heap>(graph, start, goal, manhattan(goal));
+			const auto quaternary = astar_shortest_path<quaternary_heap>(graph, start, goal, workspace, manhattan(goal));
+			const auto reused = astar_shortest_path(graph, start, goal, workspace, manhattan(goal));
+			for(auto const& [distance, path] : { radix, quaternary, reused }) {
+				CHECK(distance == expected[goal].first);
+				if(expected[goal].first == inf<int>)
+					CHECK(path.empty());
+				else
+					check_path(graph, start, goal, path, distance);
+			}
+		}
+
+		const vertex_index_t goal = 299;
+		int found = -1;
+		astar_shortest_path(graph, start, [&](vertex_index_t index, int distance, vertex_index_t) {
+			if(index != goal)
+				return false;
+			found = distance;
+			return true;
+		}, workspace, dijkstra_default_weight_invokable<graph_t>(), manhattan(goal));
+		if(expected[goal].first != inf<int>)
+			CHECK(found == expected[goal].first);
+	}
+	SECTION("narrow weights")
+	{
+		const adjacency_list<directed, wt<std::uint8_t>> chain(4, std::vector<std::tuple<vertex_index_t, vertex_index_t, std::uint8_t>>{ { 0, 1, 200 }, { 1, 2, 200 }, { 2, 3, 200 } });
+		const auto zero = [](vertex_index_t){ return dial_distance_t(0); };
+		search_workspace workspace(chain);
+
+		const auto [distance, path] = astar_shortest_path(chain, 0, 3, zero);
+		static_assert(std::is_same_v<std::remove_const_t<decltype(distance)>, dial_distance_t>);
+		CHECK(distance == 600);
+		check_path(chain, 0, 3, path, distance);
+		CHECK(astar_shortest_path(chain, 0, 3, workspace, zero).first == 600);
+		dial_distance_t visited = 0;
+		astar(chain, 0, [&](vertex_index_t index, dial_distance_t distance){
+			visited = distance;
+			return index == 3;
+		}, dijkstra_default_weight_invokable<decltype(chain)>(), zero);
+		CHECK(visited == 600);
+	}
+	SECTION("visitor")
+	{
+		const vertex_index_t goal = 299;
+		std::size_t astar_visits = 0, dijkstra_visits = 0;
+		const bool found = astar(graph, start, [&](vertex_index_t index, int distance){
+			++astar_visits;
+			if(index != goal)
+				return false;
+			CHECK(distance == expected[goal].first);
+			return true;
+		}, dijkstra_default_weight_invokable<graph_t>(), manhattan(goal));
+		CHECK(found == (expected[goal].first != inf<int>));
+		dijkstra(graph, start, [&](vertex_index_t index, int){
+			++dijkstra_visits;
+			return index == goal;
+		});
+		CHECK(astar_visits <= dijkstra_visits);
+	}
+}
@@ -0,0 +1,127 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include "../random_graphs.hpp"
+#include <vector>
+#include <random>
+
+TEST_CASE("bellman_ford", "[quiver][search]")
+{
+	thread_pool pool(3);
+
+	// the weight of a cycle given in edge order
+	const auto cycle_weight = [](auto const& graph, std::vector<vertex_index_t> const& cycle){
+		int weight = 0;
+		for(std::size_t i = 0; i < cycle.size(); ++i) {
+			auto const* edge = graph.E(cycle[i], cycle[(i + 1) % cycle.size()]);
+			REQUIRE(edge != nullptr);
+			weight += edge->weight;
+		}
+		return weight;
+	};
+
+	SECTION("non-negative weights")
+	{
+		const std::size_t V = 300;
+		const auto graph = random_graph<adjacency_list<directed, wt<int>>>(V, 3 * V, std::uniform_int_distribution<int>(0, 30), 3);
+		const auto expected = dijkstra_shortest_path(graph, 4);
+		const auto bellman_ford = bellman_ford_shortest_path(graph, 4);
+		const auto spfa = spfa_shortest_path(graph, 4);
+		const auto parallel = parallel_bellman_ford_shortest_path(graph, 4, pool);
+		for(vertex_index_t v = 0; v < V; ++v) {
+			CHECK(bellman_ford[v].first == expected[v].first);
+			CHECK(spfa[v].first == expected[v].first);
+			CHECK(parallel[v].first == expected[v].first);
+		}
+		CHECK(find_negative_cycle(graph).empty());
+	}
+	SECTION("negative weights")
+	{
+		// a potential keeps the cycles non-negative while many edges are negative
+		std::mt19937 engine(8);
+		const std::size_t V = 200;
+		std::uniform_int_distribution<int> potential_distribution(0, 100);
+		std::vector<int> potential(V);
+		for(int& p : potential)
+			p = potential_distribution(engine);
+		const auto shifted = random_graph<adjacency_list<directed, wt<int>>>(V, 4 * V, std::uniform_int_distribution<int>(0, 20), 8);
+		const auto graph = shifted_by_potential(shifted, potential);
+		const auto expected = dijkstra_shortest_path(shifted, 0);
+		const auto bellman_ford = bellman_ford_shortest_path(graph, 0);
+		const auto spfa = spfa_shortest_path(graph, 0);
+		const auto parallel = parallel_bellman_ford_shortest_path(graph, 0, pool);
+		for(vertex_index_t v = 0; v < V; ++v) {
+			if(expected[v].first == inf<int>) {
+				CHECK(bellman_ford[v].first == inf<int>);
+				continue;
+			}
+			const int distance = expected[v].first + potential[0] - potential[v];
+			CHECK(bellman_ford[v].first == distance);
+			CHECK(spfa[v].first == distance);
+			CHECK(parallel[v].first == distance);
+			if(v != 0)
+				CHECK(bellman_ford[bellman_ford[v].second].first + graph.E(bellman_ford[v].second, v)->weight == distance);
+		}
+		CHECK(find_negative_cycle(graph).empty());
+	}
+	SECTION("negative cycle")
+	{
+		// arbitrage: 1 -> 2 -> 3 -> 1 has weight -1, 4 is not reachable from it
+		adjacency_list<directed, wt<int>> graph(6);
+		graph.E.emplace(0, 1, 5);
+		graph.E.emplace(1, 2, 2);
+		graph.E.emplace(2, 3, -4);
+		graph.E.emplace(3, 1, 1);
+		graph.E.emplace(3, 5, 7);
+		graph.E.emplace(4, 0, 1);
+
+		const auto check_throws = [&](auto&& search){
+			try {
+				(void)search();
+				FAIL("no negative_cycle thrown");
+			} catch(negative_cycle const& e) {
+				CHECK(e.cycle.size() == 3);
+				CHECK(cycle_weight(graph, e.cycle) == -1);
+			}
+		};
+		check_throws([&]{ return bellman_ford_shortest_path(graph, 0); });
+		check_throws([&]{ return spfa_shortest_path(graph, 0); });
+		check_throws([&]{ return parallel_bellman_ford_shortest_path(graph, 0, pool); });
+		CHECK(bellman_ford_shortest_path(graph, 5)[5].first == 0);
+		const auto cycle = find_negative_cycle(graph);
+		CHECK(cycle.size() == 3);
+		CHECK(cycle_weight(graph, cycle) == -1);
+	}
+	SECTION("asymmetric weights")
+	{
+		// the weight depends on the direction of the edge, as seen from its tail
+		const std::size_t V = 150;
+		const auto graph = random_graph<adjacency_list<directed>>(V, 4 * V, 5);
+		const auto weight = [](vertex_index_t from, auto const& edge){
+			return static_cast<int>(3 * from + 1) % 11 + static_cast<int>(edge.to) % 7;
+		};
+		const auto expected = dijkstra_shortest_path(graph, 2, weight);
+		const auto parallel = parallel_bellman_ford_shortest_path(graph, 2, weight, pool);
+		for(vertex_index_t v = 0; v < V; ++v)
+			CHECK(parallel[v].first == expected[v].first);
+	}
+	SECTION("undirected")
+	{
+		adjacency_list<undirected, wt<int>> graph(4);
+		graph.E.emplace(0, 1, 2);
+		graph.E.emplace(1, 2, 3);
+		graph.E.emplace(0, 2, 9);
+		const auto parallel = parallel_bellman_ford_shortest_path(graph, 0, pool);
+		CHECK(parallel[2].first == 5);
+		CHECK(parallel[3].first == inf<int>);
+		graph.E.emplace(2, 3, -1);
+		CHECK_THROWS_AS(bellman_ford_shortest_path(graph, 0), negative_cycle);
+	}
+}
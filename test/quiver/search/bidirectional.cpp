@@ -0,0 +1,77 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include "../random_graphs.hpp"
+#include <vector>
+#include <random>
+#include <tuple>
+#include <cstdint>
+#include <type_traits>
+
+TEST_CASE("bidirectional", "[quiver][search]")
+{
+	const std::size_t V = 400;
+	const auto graph = random_graph<adjacency_list<directed, wt<int>>>(V, 2 * V, std::uniform_int_distribution<int>(0, 50), 42);
+	const auto undirected_graph = random_graph<adjacency_list<undirected, wt<int>>>(V, 2 * V, std::uniform_int_distribution<int>(0, 50), 42);
+	const auto transposed = transpose(graph);
+
+	SECTION("dijkstra")
+	{
+		for(vertex_index_t source : { 0, 13, 77 }) {
+			const auto expected = dijkstra_shortest_path(graph, source);
+			const auto undirected_expected = dijkstra_shortest_path(undirected_graph, source);
+			for(vertex_index_t target = 0; target < V; target += 7) {
+				const auto result = bidirectional_dijkstra(graph, transposed, source, target);
+				CHECK(result.first == expected[target].first);
+				if(expected[target].first != inf<int>)
+					check_path(graph, source, target, result.second, result.first);
+				else
+					CHECK(result.second.empty());
+
+				const auto undirected_result = bidirectional_dijkstra(undirected_graph, source, target);
+				CHECK(undirected_result.first == undirected_expected[target].first);
+				if(undirected_expected[target].first != inf<int>)
+					check_path(undirected_graph, source, target, undirected_result.second, undirected_result.first);
+			}
+		}
+	}
+	SECTION("narrow weights")
+	{
+		const std::vector<std::tuple<vertex_index_t, vertex_index_t, std::uint8_t>> edges = { { 0, 1, 200 }, { 1, 2, 200 }, { 2, 3, 200 } };
+		const adjacency_list<undirected, wt<std::uint8_t>> chain(4, edges);
+		const auto [distance, path] = bidirectional_dijkstra(chain, 0, 3);
+		static_assert(std::is_same_v<std::remove_const_t<decltype(distance)>, dial_distance_t>);
+		CHECK(distance == 600);
+		check_path(chain, 0, 3, path, distance);
+
+		const adjacency_list<directed, wt<std::uint8_t>> directed_chain(4, edges);
+		CHECK(bidirectional_dijkstra(directed_chain, transpose(directed_chain), 0, 3).first == 600);
+	}
+	SECTION("bfs")
+	{
+		for(vertex_index_t source : { 0, 13, 77 }) {
+			const auto expected = bfs_shortest_path(graph, source);
+			const auto undirected_expected = bfs_shortest_path(undirected_graph, source);
+			for(vertex_index_t target = 0; target < V; target += 3) {
+				const auto result = bidirectional_bfs(graph, transposed, source, target);
+				CHECK(result.first == expected[target].first);
+				if(expected[target].first != inf<bfs_path_length_t>)
+					check_path(graph, source, target, result.second, result.first, [](auto const&){ return 1u; });
+				else
+					CHECK(result.second.empty());
+
+				const auto undirected_result = bidirectional_bfs(undirected_graph, source, target);
+				CHECK(undirected_result.first == undirected_expected[target].first);
+				if(undirected_expected[target].first != inf<bfs_path_length_t>)
+					check_path(undirected_graph, source, target, undirected_result.second, undirected_result.first, [](auto const&){ return 1u; });
+			}
+		}
+	}
+}
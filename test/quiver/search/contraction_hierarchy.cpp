@@ -0,0 +1,69 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include "../random_graphs.hpp"
+#include <vector>
+#include <random>
+
+TEST_CASE("contraction_hierarchy", "[quiver][search]")
+{
+	const std::size_t V = 300;
+	const auto graph = random_graph<adjacency_list<directed, wt<int>>>(V, 3 * V, std::uniform_int_distribution<int>(0, 40), 7);
+	const auto undirected_graph = random_graph<adjacency_list<undirected, wt<int>>>(V, 3 * V, std::uniform_int_distribution<int>(0, 40), 7);
+
+	const auto check = [](auto const& graph, auto const& hierarchy){
+		REQUIRE(hierarchy.size() == graph.V.size());
+		contraction_hierarchy_query query(hierarchy);
+		for(vertex_index_t source : { 0, 5, 99, 250 }) {
+			const auto expected = dijkstra_shortest_path(graph, source);
+			for(vertex_index_t target = 0; target < graph.V.size(); ++target) {
+				CHECK(query.distance(source, target) == expected[target].first);
+				const auto [distance, path] = query.shortest_path(source, target);
+				CHECK(distance == expected[target].first);
+				if(expected[target].first == inf<int>) {
+					CHECK(path.empty());
+					continue;
+				}
+				check_path(graph, source, target, path, distance);
+			}
+		}
+	};
+
+	SECTION("directed")
+	{
+		const contraction_hierarchy hierarchy(graph);
+		check(graph, hierarchy);
+		for(vertex_index_t index = 0; index < V; ++index) {
+			for(auto const& arc : hierarchy.up_arcs(index))
+				CHECK(hierarchy.rank(index) < hierarchy.rank(arc.to));
+			for(auto const& arc : hierarchy.down_arcs(index))
+				CHECK(hierarchy.rank(index) < hierarchy.rank(arc.to));
+		}
+		CHECK(hierarchy.distance(0, 0) == 0);
+		CHECK(hierarchy.shortest_path(0, 0).second == std::vector<vertex_index_t>{ 0 });
+	}
+	SECTION("undirected")
+	{
+		const contraction_hierarchy hierarchy(undirected_graph, [](vertex_index_t, auto const& edge){ return edge.weight; });
+		check(undirected_graph, hierarchy);
+	}
+	SECTION("path")
+	{
+		// contracting the inner vertices of a path needs shortcuts that unpack into the whole path
+		adjacency_list<directed, wt<double>> path(6);
+		for(vertex_index_t index = 0; index + 1 < 6; ++index)
+			path.E.emplace(index, index + 1, 1.5);
+		const contraction_hierarchy hierarchy(path);
+		const auto [distance, vertices] = hierarchy.shortest_path(0, 5);
+		CHECK(distance == 7.5);
+		CHECK(vertices == std::vector<vertex_index_t>{ 0, 1, 2, 3, 4, 5 });
+		CHECK(hierarchy.distance(5, 0) == inf<double>);
+	}
+}
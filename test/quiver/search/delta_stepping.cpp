@@ -0,0 +1,58 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include "../random_graphs.hpp"
+#include <vector>
+#include <random>
+#include <tuple>
+#include <cstdint>
+#include <type_traits>
+
+TEST_CASE("delta_stepping", "[quiver][search]")
+{
+	const std::size_t V = 1000;
+	const auto graph = random_graph<adjacency_list<directed, wt<int>>>(V, 4 * V, std::uniform_int_distribution<int>(0, 100), 42);
+	const auto undirected_graph = random_graph<adjacency_list<undirected, wt<double>>>(V, 4 * V, [distribution = std::uniform_int_distribution<int>(0, 100)](std::mt19937& engine) mutable {
+		return distribution(engine) / 8.0;
+	}, 42);
+
+	const auto check = [](auto const& graph, auto const& expected, auto const& actual) {
+		REQUIRE(expected.size() == actual.size());
+		for(vertex_index_t v = 0; v < expected.size(); ++v) {
+			REQUIRE(expected[v].first == actual[v].first);
+			const vertex_index_t predecessor = actual[v].second;
+			if(predecessor != v && actual[v].first != inf<typename std::decay_t<decltype(actual)>::value_type::first_type>) {
+				auto const* edge = graph.E(predecessor, v);
+				REQUIRE(edge != nullptr);
+				CHECK(actual[predecessor].first + edge->weight == actual[v].first);
+			}
+		}
+	};
+
+	for(std::size_t threads : { 1, 4 }) {
+		thread_pool pool(threads);
+		check(graph, dijkstra_shortest_path(graph, 0), delta_stepping_shortest_path(graph, 0, pool));
+		for(int delta : { 1, 10, 1000 })
+			check(graph, dijkstra_shortest_path(graph, 5), delta_stepping_shortest_path(graph, 5, dijkstra_default_weight_invokable<decltype(graph)>(), delta, pool));
+		check(undirected_graph, dijkstra_shortest_path(undirected_graph, 3), delta_stepping_shortest_path(undirected_graph, 3, pool));
+
+		const std::vector<vertex_index_t> start = { 1, 2, 1 };
+		check(graph, dijkstra_shortest_path(graph, start), delta_stepping_shortest_path(graph, start, pool));
+	}
+	check(graph, dijkstra_shortest_path(graph, 9), delta_stepping_shortest_path(graph, 9));
+
+	// narrow weights are widened like for dijkstra_shortest_path
+	const auto narrow_graph = random_graph<adjacency_list<directed, wt<std::uint8_t>>>(V, 4 * V, std::uniform_int_distribution<unsigned>(0, 255), 43);
+	const auto narrow = delta_stepping_shortest_path(narrow_graph, 0);
+	static_assert(std::is_same_v<decltype(narrow)::value_type::first_type, dial_distance_t>);
+	check(narrow_graph, dijkstra_shortest_path(narrow_graph, 0), narrow);
+	const adjacency_list<directed, wt<std::uint8_t>> chain(4, std::vector<std::tuple<vertex_index_t, vertex_index_t, std::uint8_t>>{ { 0, 1, 200 }, { 1, 2, 200 }, { 2, 3, 200 } });
+	CHECK(delta_stepping_shortest_path(chain, 0)[3].first == 600);
+}
@@ -8,7 +8,47 @@
 #include <catch2/catch.hpp>
 #include <quiver.hpp>
 using namespace quiver;
+#include "../random_graphs.hpp"
+#include <algorithm>
+#include <utility>
 #include <vector>
+#include <ranges>
+
+namespace
+{
+	struct recorder_t
+	{
+		std::vector<std::pair<vertex_index_t, vertex_index_t>> discovered, examined, finished;
+
+		bool discover_vertex(vertex_index_t index, vertex_index_t parent)
+		{
+			discovered.emplace_back(index, parent);
+			return false;
+		}
+		void examine_edge(vertex_index_t from, auto const& edge)
+		{
+			examined.emplace_back(from, edge.to);
+		}
+		bool finish_vertex(vertex_index_t index, vertex_index_t parent)
+		{
+			finished.emplace_back(index, parent);
+			return false;
+		}
+	};
+
+	template<typename graph_t>
+	void recurse(graph_t const& graph, vertex_index_t index, vertex_index_t parent, std::vector<bool>& discovered, recorder_t& expected)
+	{
+		discovered[index] = true;
+		expected.discovered.emplace_back(index, parent);
+		for(auto const& edge : graph.V[index].out_edges) {
+			expected.examined.emplace_back(index, edge.to);
+			if(!discovered[edge.to])
+				recurse(graph, edge.to, index, discovered, expected);
+		}
+		expected.finished.emplace_back(index, parent);
+	}
+}
 
 TEST_CASE("dfs", "[quiver][search]")
 {
@@ -37,4 +77,64 @@ TEST_CASE("dfs", "[quiver][search]")
 		CHECK(visited[3] == 2);
 		CHECK(visited[4] == 0);
 	}
+	SECTION("events")
+	{
+		const std::size_t V = 300;
+		const auto graph = random_graph<adjacency_list<directed, void, void>>(V, 2 * V, 21);
+
+		recorder_t expected;
+		std::vector<bool> discovered(V, false);
+		for(vertex_index_t root = 0; root < V; ++root)
+			if(!discovered[root])
+				recurse(graph, root, root, discovered, expected);
+
+		recorder_t actual;
+		CHECK(dfs_events(graph, std::views::iota(vertex_index_t(0), V), actual) == false);
+		CHECK(actual.discovered == expected.discovered);
+		CHECK(actual.examined == expected.examined);
+		CHECK(actual.finished == expected.finished);
+
+		search_workspace workspace(graph);
+		recorder_t reused;
+		CHECK(dfs_events(graph, std::views::iota(vertex_index_t(0), V), reused, workspace) == false);
+		CHECK(reused.finished == expected.finished);
+
+		std::vector<vertex_index_t> preorder;
+		dfs(graph, std::views::iota(vertex_index_t(0), V), [&preorder](vertex_index_t index){ preorder.push_back(index); return false; });
+		CHECK(std::ranges::equal(preorder, expected.discovered, {}, {}, &std::pair<vertex_index_t, vertex_index_t>::first));
+
+		// only finish_vertex, exiting early
+		struct
+		{
+			std::size_t count = 0;
+			bool finish_vertex(vertex_index_t, vertex_index_t)
+			{
+				return ++count == 7;
+			}
+		} finisher;
+		CHECK(dfs_events(graph, 0, finisher) == true);
+		CHECK(finisher.count == 7);
+	}
+	SECTION("deep")
+	{
+		// far deeper than the native stack would allow for recursion
+		const std::size_t V = 1'000'000;
+		const auto graph = linear(V);
+		std::size_t depth = 0, max_depth = 0;
+		struct
+		{
+			std::size_t& depth, & max_depth;
+			void discover_vertex(vertex_index_t, vertex_index_t)
+			{
+				max_depth = std::max(max_depth, ++depth);
+			}
+			void finish_vertex(vertex_index_t, vertex_index_t)
+			{
+				--depth;
+			}
+		} visitor{ depth, max_depth };
+		CHECK(dfs_events(graph, 0, visitor) == false);
+		CHECK(depth == 0);
+		CHECK(max_depth == V);
+	}
 }
@@ -8,8 +8,63 @@
 #include <catch2/catch.hpp>
 #include <quiver.hpp>
 using namespace quiver;
+#include "../random_graphs.hpp"
 #include <vector>
 #include <unordered_map>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <tuple>
+#include <stdexcept>
+#include <iterator>
+#include <ranges>
+#include <cstddef>
+
+namespace
+{
+	// An input range that can only be traversed once, like one reading from a stream.
+	struct single_pass_targets
+	{
+		std::vector<vertex_index_t> values;
+		mutable std::size_t position = 0;
+
+		struct iterator
+		{
+			using value_type = vertex_index_t;
+			using difference_type = std::ptrdiff_t;
+
+			single_pass_targets const* range;
+
+			vertex_index_t operator*() const
+			{
+				return range->values[range->position];
+			}
+			iterator& operator++()
+			{
+				++range->position;
+				return *this;
+			}
+			void operator++(int)
+			{
+				++*this;
+			}
+			bool operator==(std::default_sentinel_t) const
+			{
+				return range->position == range->values.size();
+			}
+		};
+		iterator begin() const
+		{
+			return { this };
+		}
+		std::default_sentinel_t end() const
+		{
+			return {};
+		}
+	};
+	static_assert(std::ranges::input_range<single_pass_targets const> && !std::ranges::forward_range<single_pass_targets const>);
+}
 
 TEST_CASE("dijkstra", "[quiver][search]")
 {
@@ -56,5 +111,186 @@ TEST_CASE("dijkstra", "[quiver][search]")
 		CHECK(shortest_path[2] == pair_t(4, 3));
 		CHECK(shortest_path[3] == pair_t(2, 4));
 		CHECK(shortest_path[4] == pair_t(1, 1));
+
+		CHECK(dijkstra_shortest_path_decrease_key(graph, 1) == shortest_path);
+		visited.clear();
+		auto decrease_key_visitor = [&visited](vertex_index_t index, distance_t, vertex_index_t){
+			visited.push_back(index);
+			return index == 3;
+		};
+		CHECK(dijkstra_shortest_path_decrease_key(graph, 1, decrease_key_visitor, dijkstra_default_weight_invokable<graph_t>()) == true);
+		CHECK(visited == std::vector<vertex_index_t>{ 1, 4, 3 });
 	}
+	SECTION("heaps")
+	{
+		const auto graph = random_graph<adjacency_list<directed, wt<unsigned>>>(500, 2000, std::uniform_int_distribution<unsigned>(0, 100), 42);
+
+		const auto check = [](auto const& expected, auto const& actual) {
+			REQUIRE(expected.size() == actual.size());
+			for(vertex_index_t v = 0; v < expected.size(); ++v)
+				CHECK(expected[v].first == actual[v].first);
+		};
+		const auto expected = dijkstra_shortest_path(graph, 0);
+		check(expected, dijkstra_shortest_path<quaternary_heap>(graph, 0));
+		check(expected, dijkstra_shortest_path<octonary_heap>(graph, 0));
+		check(expected, dijkstra_shortest_path<radix_heap>(graph, 0));
+		check(expected, dijkstra_shortest_path_decrease_key(graph, 0));
+
+		std::size_t visits = 0;
+		CHECK(dijkstra<radix_heap>(graph, 0, [&visits](vertex_index_t, unsigned){ return ++visits == 10; }) == true);
+	}
+	SECTION("dial")
+	{
+		const auto graph = random_graph<adjacency_list<directed, wt<std::uint8_t>>>(500, 2000, std::uniform_int_distribution<unsigned>(0, 255), 7);
+
+		const auto expected = dijkstra_shortest_path(graph, 3, [](vertex_index_t, auto const& out_edge){ return unsigned(out_edge.weight); });
+		const auto actual = dial_shortest_path(graph, 3);
+		const auto selected = dijkstra_shortest_path(graph, 3);
+		static_assert(std::is_same_v<decltype(selected)::value_type::first_type, dial_distance_t>);
+		REQUIRE(expected.size() == actual.size());
+		REQUIRE(selected.size() == actual.size());
+		for(vertex_index_t v = 0; v < expected.size(); ++v) {
+			if(expected[v].first == inf<unsigned>) {
+				CHECK(actual[v].first == inf<dial_distance_t>);
+				continue;
+			}
+			CHECK(expected[v].first == actual[v].first);
+			CHECK(selected[v].first == actual[v].first);
+			if(v != 3)
+				CHECK(actual[actual[v].second].first + graph.E(actual[v].second, v)->weight == actual[v].first);
+		}
+	}
+	SECTION("narrow weights are widened by every overload")
+	{
+		const adjacency_list<directed, wt<std::uint8_t>> path(4, std::vector<std::tuple<vertex_index_t, vertex_index_t, std::uint8_t>>{ { 0, 1, 200 }, { 1, 2, 200 }, { 2, 3, 200 } });
+		search_workspace workspace(path);
+
+		const auto dense = dijkstra_shortest_path(path, 0);
+		const auto heap = dijkstra_shortest_path<binary_heap>(path, 0);
+		const auto sparse = dijkstra_shortest_path(path, 0, workspace);
+		const auto within = dijkstra_shortest_path_within(path, 0, 1000, workspace);
+		const auto targets = dijkstra_shortest_path_to_targets(path, 0, std::vector<vertex_index_t>{ 3 }, workspace);
+		const auto decrease_key = dijkstra_shortest_path_decrease_key(path, 0);
+		static_assert(std::is_same_v<decltype(dense)::value_type::first_type, dial_distance_t>);
+		static_assert(std::is_same_v<decltype(heap)::value_type::first_type, dial_distance_t>);
+		static_assert(std::is_same_v<std::tuple_element_t<1, decltype(sparse)::value_type>, dial_distance_t>);
+		static_assert(std::is_same_v<std::tuple_element_t<1, decltype(within)::value_type>, dial_distance_t>);
+		static_assert(std::is_same_v<std::tuple_element_t<1, decltype(targets)::value_type>, dial_distance_t>);
+		static_assert(std::is_same_v<decltype(decrease_key)::value_type::first_type, dial_distance_t>);
+		CHECK(dense[3].first == 600);
+		CHECK(heap[3].first == 600);
+		CHECK(decrease_key[3].first == 600);
+		REQUIRE(sparse.size() == 4);
+		CHECK(std::get<1>(sparse.back()) == 600);
+		REQUIRE(within.size() == 4);
+		CHECK(std::get<1>(within.back()) == 600);
+		REQUIRE(targets.size() == 4);
+		CHECK(std::get<1>(targets.back()) == 600);
+
+		dial_distance_t visited = 0;
+		dijkstra(path, 0, [&](vertex_index_t vertex, dial_distance_t distance) -> bool {
+			if(vertex == 3)
+				visited = distance;
+			return false;
+		});
+		CHECK(visited == 600);
+		visited = 0;
+		dijkstra_shortest_path(path, 0, [&](vertex_index_t vertex, dial_distance_t distance, vertex_index_t) -> bool {
+			if(vertex == 3)
+				visited = distance;
+			return false;
+		}, workspace, dijkstra_default_weight_invokable<decltype(path)>());
+		CHECK(visited == 600);
+	}
+	SECTION("queries")
+	{
+		const auto graph = random_graph<adjacency_list<directed, wt<int>>>(400, 1200, std::uniform_int_distribution<int>(0, 20), 9);
+		const auto expected = dijkstra_shortest_path(graph, 5);
+		search_workspace workspace(graph);
+
+		for(int radius : { 0, 10, 35, 1000 }) {
+			const auto result = dijkstra_shortest_path_within(graph, 5, radius, workspace);
+			std::size_t inside = 0;
+			for(auto const& [distance, predecessor] : expected)
+				inside += distance <= radius;
+			CHECK(result.size() == inside);
+			for(auto const& [vertex, distance, predecessor] : result) {
+				CHECK(distance <= radius);
+				CHECK(distance == expected[vertex].first);
+			}
+		}
+
+		std::vector<vertex_index_t> targets = { 7, 300, 300, 12, 399, 5 };
+		std::vector<int> target_distances; // of the distinct reachable targets
+		for(vertex_index_t target : { 7, 300, 12, 399, 5 })
+			if(expected[target].first != inf<int>)
+				target_distances.push_back(expected[target].first);
+		std::sort(target_distances.begin(), target_distances.end());
+		for(std::size_t k : { 1, 2, 3 }) {
+			const auto result = dijkstra_shortest_path_to_targets(graph, 5, targets, k, workspace);
+			REQUIRE(!result.empty());
+			for(auto const& [vertex, distance, predecessor] : result)
+				CHECK(distance == expected[vertex].first);
+			if(k <= target_distances.size())
+				CHECK(std::get<1>(result.back()) == target_distances[k - 1]);
+		}
+		const auto all = dijkstra_shortest_path_to_targets(graph, 5, targets);
+		for(vertex_index_t target : targets)
+			if(expected[target].first != inf<int>)
+				CHECK(std::find_if(all.begin(), all.end(), [target](auto const& entry){ return std::get<0>(entry) == target; }) != all.end());
+		CHECK(dijkstra_shortest_path_to_targets(graph, 5, std::vector<vertex_index_t>{}, workspace).empty());
+		CHECK(dijkstra_shortest_path_to_targets(graph, 5, std::vector<vertex_index_t>{ 5 }, workspace).size() == 1);
+
+		// a single pass range of targets leaves no stale target marks behind
+		const auto single_pass = dijkstra_shortest_path_to_targets(graph, 5, single_pass_targets{ { 7, 300, 300, 12 } }, workspace);
+		CHECK(!single_pass.empty());
+		if(expected[399].first != inf<int>) {
+			const auto result = dijkstra_shortest_path_to_targets(graph, 5, std::vector<vertex_index_t>{ 399 }, 1, workspace);
+			REQUIRE(!result.empty());
+			CHECK(std::get<0>(result.back()) == 399);
+		}
+
+		// a throwing weight_invokable leaves no stale target marks behind
+		auto throwing = [](vertex_index_t, auto const&) -> int { throw std::runtime_error("weight"); };
+		CHECK_THROWS(dijkstra_shortest_path_to_targets(graph, 5, targets, workspace, throwing));
+		if(expected[399].first != inf<int>) {
+			const auto result = dijkstra_shortest_path_to_targets(graph, 5, std::vector<vertex_index_t>{ 399 }, 1, workspace);
+			REQUIRE(!result.empty());
+			CHECK(std::get<0>(result.back()) == 399);
+		}
+	}
+}
+
+TEST_CASE("narrow weights", "[quiver][search]")
+{
+	// every shortest path entry point adds narrow weights in dijkstra_distance_t, so 3 * 200 does not wrap around
+	const std::vector<std::tuple<vertex_index_t, vertex_index_t, std::uint8_t>> edges = { { 0, 1, 200 }, { 1, 2, 200 }, { 2, 3, 200 } };
+	using graph_t = adjacency_list<directed, wt<std::uint8_t>>;
+	const graph_t chain(4, edges);
+	const auto transposed = transpose(chain);
+	const adjacency_list<undirected, wt<std::uint8_t>> undirected_chain(4, edges);
+	const auto weight = dijkstra_default_weight_invokable<graph_t>();
+	const std::vector<vertex_index_t> source = { 0 }, target = { 3 };
+	thread_pool pool(2);
+
+	CHECK(dijkstra_shortest_path(chain, 0)[3].first == 600);
+	CHECK(dial_shortest_path(chain, 0)[3].first == 600);
+	CHECK(dijkstra_shortest_path_decrease_key(chain, 0)[3].first == 600);
+	CHECK(astar_shortest_path(chain, 0, 3, [](vertex_index_t){ return dial_distance_t(0); }).first == 600);
+	CHECK(bidirectional_dijkstra(chain, transposed, 0, 3).first == 600);
+	CHECK(bidirectional_dijkstra(undirected_chain, 0, 3).first == 600);
+	CHECK(delta_stepping_shortest_path(chain, 0, pool)[3].first == 600);
+	const contraction_hierarchy hierarchy(chain);
+	CHECK(hierarchy.distance(0, 3) == 600);
+	CHECK(many_to_many(hierarchy, source, target, pool)(0, 0) == 600);
+	CHECK(many_to_many(chain, source, target, weight, pool)(0, 0) == 600);
+	const auto table = compute_landmarks(chain, transposed, source);
+	CHECK(table.distance_from(0, 3) == 600);
+	CHECK(astar_shortest_path(chain, 0, 3, table.heuristic(3)).first == 600);
+	CHECK(bellman_ford_shortest_path(chain, 0)[3].first == 600);
+	CHECK(spfa_shortest_path(chain, 0)[3].first == 600);
+	CHECK(parallel_bellman_ford_shortest_path(chain, 0, pool)[3].first == 600);
+	CHECK(johnson_all_pairs(chain, pool)(0, 3) == 600);
+	CHECK(floyd_warshall(chain, pool)(0, 3) == 600);
+	CHECK(floyd_warshall_shortest_path(chain, pool).first(0, 3) == 600);
 }
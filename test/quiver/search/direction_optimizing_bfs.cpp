@@ -0,0 +1,65 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include "../random_graphs.hpp"
+#include <vector>
+
+TEST_CASE("direction_optimizing_bfs", "[quiver][search]")
+{
+	SECTION("directed")
+	{
+		using graph_t = adjacency_list<directed, void, void>;
+		graph_t graph(5);
+		graph.E.emplace(0, 1);
+		graph.E.emplace(1, 3);
+		graph.E.emplace(1, 2);
+		graph.E.emplace(2, 0);
+		graph.E.emplace(2, 4);
+		graph.E.emplace(3, 4);
+		graph.E.emplace(4, 1);
+		const graph_t transposed = transpose(graph);
+
+		const auto shortest_path = direction_optimizing_bfs_shortest_path(graph, transposed, 1);
+		using pair_t = decltype(shortest_path)::value_type;
+		REQUIRE(shortest_path.size() == graph.V.size());
+		CHECK(shortest_path[0] == pair_t(2, 2));
+		CHECK(shortest_path[1] == pair_t(0, 1));
+		CHECK(shortest_path[2] == pair_t(1, 1));
+		CHECK(shortest_path[3] == pair_t(1, 1));
+		CHECK((shortest_path[4] == pair_t(2, 2) || shortest_path[4] == pair_t(2, 3)));
+
+		std::vector<vertex_index_t> visited;
+		auto visitor = [&visited](vertex_index_t index, bfs_path_length_t, vertex_index_t){
+			visited.push_back(index);
+			return index == 2;
+		};
+		CHECK(direction_optimizing_bfs_shortest_path(graph, transposed, 1, visitor) == true);
+		CHECK(visited.back() == 2);
+		CHECK(visited.size() <= 3);
+	}
+	SECTION("random")
+	{
+		const std::size_t V = 2000;
+		const auto check = [](auto const& expected, auto const& actual) {
+			REQUIRE(expected.size() == actual.size());
+			for(vertex_index_t v = 0; v < expected.size(); ++v) {
+				REQUIRE(expected[v].first == actual[v].first);
+				if(actual[v].first != 0 && actual[v].first != inf<bfs_path_length_t>)
+					CHECK(actual[actual[v].second].first + 1 == actual[v].first);
+			}
+		};
+
+		const auto directed_graph = random_graph<adjacency_list<directed>>(V, 8 * V, 42);
+		check(bfs_shortest_path(directed_graph, 0), direction_optimizing_bfs_shortest_path(directed_graph, transpose(directed_graph), 0));
+
+		const auto undirected_graph = random_graph<adjacency_list<undirected>>(V, 8 * V, 42);
+		check(bfs_shortest_path(undirected_graph, 7), direction_optimizing_bfs_shortest_path(undirected_graph, 7));
+	}
+}
@@ -0,0 +1,88 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include "../random_graphs.hpp"
+#include <algorithm>
+#include <sstream>
+#include <vector>
+#include <random>
+
+TEST_CASE("landmarks", "[quiver][search]")
+{
+	const std::size_t V = 300;
+	const auto graph = random_graph<adjacency_list<directed, wt<int>>>(V, 3 * V, std::uniform_int_distribution<int>(1, 30), 11);
+	const auto undirected_graph = random_graph<adjacency_list<undirected, wt<int>>>(V, 3 * V, std::uniform_int_distribution<int>(1, 30), 11);
+	const auto transposed = transpose(graph);
+	thread_pool pool(4);
+
+	const auto check = [](auto const& graph, auto const& table){
+		for(vertex_index_t source : { 0, 42, 123 }) {
+			const auto expected = dijkstra_shortest_path(graph, source);
+			for(vertex_index_t target = 0; target < graph.V.size(); target += 3) {
+				if(expected[target].first != inf<int>)
+					CHECK(table.lower_bound(source, target) <= expected[target].first);
+				const auto [distance, path] = astar_shortest_path(graph, source, target, table.heuristic(target));
+				CHECK(distance == expected[target].first);
+			}
+		}
+	};
+
+	SECTION("selection")
+	{
+		for(auto selection : { landmark_selection::farthest, landmark_selection::avoid }) {
+			auto landmarks = select_landmarks(graph, 8, selection);
+			CHECK(landmarks.size() == 8);
+			std::sort(landmarks.begin(), landmarks.end());
+			CHECK(std::adjacent_find(landmarks.begin(), landmarks.end()) == landmarks.end());
+		}
+		CHECK(select_landmarks(undirected_graph, 1000).size() == V);
+	}
+	SECTION("directed")
+	{
+		const auto landmarks = select_landmarks(graph, 6, landmark_selection::avoid);
+		const auto table = compute_landmarks(graph, transposed, landmarks, dijkstra_default_weight_invokable<decltype(graph)>(), pool);
+		CHECK(table.directed());
+		REQUIRE(table.landmarks().size() == 6);
+		const auto from_landmark = dijkstra_shortest_path(graph, landmarks[0]);
+		const auto to_landmark = dijkstra_shortest_path(transposed, landmarks[0]);
+		for(vertex_index_t index = 0; index < V; ++index) {
+			CHECK(table.distance_from(0, index) == from_landmark[index].first);
+			CHECK(table.distance_to(0, index) == to_landmark[index].first);
+		}
+		check(graph, table);
+	}
+	SECTION("undirected")
+	{
+		const auto table = compute_landmarks(undirected_graph, select_landmarks(undirected_graph, 6));
+		CHECK(!table.directed());
+		check(undirected_graph, table);
+	}
+	SECTION("serialization")
+	{
+		const auto table = compute_landmarks(graph, transposed, select_landmarks(graph, 4));
+		std::stringstream stream;
+		table.save(stream);
+		const auto loaded = decltype(table)::load(stream);
+		CHECK(loaded.vertex_count() == V);
+		CHECK(loaded.directed());
+		CHECK(std::ranges::equal(loaded.landmarks(), table.landmarks()));
+		for(vertex_index_t from = 0; from < V; from += 5)
+			for(vertex_index_t to = 0; to < V; to += 7)
+				CHECK(loaded.lower_bound(from, to) == table.lower_bound(from, to));
+
+		std::stringstream truncated(stream.str().substr(0, 60));
+		CHECK_THROWS_AS(decltype(table)::load(truncated), invalid_format);
+		std::stringstream garbage("not a landmark table at all");
+		CHECK_THROWS_AS(decltype(table)::load(garbage), invalid_format);
+		std::stringstream other_types;
+		landmark_table<double>().save(other_types);
+		CHECK_THROWS_AS(decltype(table)::load(other_types), invalid_format);
+	}
+}
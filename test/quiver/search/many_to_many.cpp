@@ -0,0 +1,55 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include "../random_graphs.hpp"
+#include <vector>
+#include <random>
+
+TEST_CASE("many_to_many", "[quiver][search]")
+{
+	const std::size_t V = 300;
+	const auto graph = random_graph<adjacency_list<directed, wt<int>>>(V, 3 * V, std::uniform_int_distribution<int>(0, 25), 5);
+	const auto undirected_graph = random_graph<adjacency_list<undirected, wt<int>>>(V, 3 * V, std::uniform_int_distribution<int>(0, 25), 5);
+	const std::vector<vertex_index_t> sources = { 0, 17, 17, 42, 99, 250, 299 };
+	std::vector<vertex_index_t> targets = { 17, 3, 3 };
+	for(vertex_index_t index = 0; index < V; index += 11)
+		targets.push_back(index);
+	thread_pool pool(3);
+
+	const auto check = [&](auto const& graph, auto const& matrix){
+		REQUIRE(matrix.rows() == sources.size());
+		REQUIRE(matrix.columns() == targets.size());
+		for(std::size_t row = 0; row < sources.size(); ++row) {
+			const auto expected = dijkstra_shortest_path(graph, sources[row]);
+			for(std::size_t column = 0; column < targets.size(); ++column)
+				CHECK(matrix(row, column) == expected[targets[column]].first);
+		}
+	};
+
+	SECTION("dijkstra")
+	{
+		check(graph, many_to_many(graph, sources, targets, pool));
+		check(undirected_graph, many_to_many(undirected_graph, sources, targets));
+	}
+	SECTION("contraction hierarchy")
+	{
+		const contraction_hierarchy hierarchy(graph);
+		check(graph, many_to_many(hierarchy, sources, targets, pool));
+		const contraction_hierarchy undirected_hierarchy(undirected_graph);
+		check(undirected_graph, many_to_many(undirected_hierarchy, sources, targets));
+	}
+	SECTION("empty")
+	{
+		const auto matrix = many_to_many(graph, std::vector<vertex_index_t>{}, targets, pool);
+		CHECK(matrix.rows() == 0);
+		CHECK(matrix.columns() == targets.size());
+		CHECK(many_to_many(graph, sources, std::vector<vertex_index_t>{}).data().empty());
+	}
+}
@@ -0,0 +1,63 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include "../random_graphs.hpp"
+#include <vector>
+#include <atomic>
+#include <stdexcept>
+
+TEST_CASE("thread_pool", "[quiver]")
+{
+	for(std::size_t threads : { 1, 4 }) {
+		thread_pool pool(threads);
+		REQUIRE(pool.size() == threads);
+
+		std::vector<int> hits(1000, 0);
+		pool.for_each(hits.size(), [&hits](std::size_t, std::size_t i){ ++hits[i]; });
+		CHECK(std::count(hits.begin(), hits.end(), 1) == 1000);
+
+		std::atomic<std::size_t> runs = 0;
+		pool.run([&runs](std::size_t){ ++runs; });
+		CHECK(runs == threads);
+
+		CHECK_THROWS_AS(pool.run([](std::size_t thread_index){
+			if(thread_index == 0)
+				throw std::runtime_error("job failed");
+		}), std::runtime_error);
+	}
+}
+
+TEST_CASE("parallel_bfs", "[quiver][search]")
+{
+	const std::size_t V = 2000;
+	const auto directed_graph = random_graph<adjacency_list<directed>>(V, 3 * V, 42);
+	const auto undirected_graph = random_graph<adjacency_list<undirected>>(V, 3 * V, 42);
+
+	const auto check = [](auto const& graph, auto const& expected, auto const& actual) {
+		REQUIRE(expected.size() == actual.size());
+		for(vertex_index_t v = 0; v < expected.size(); ++v) {
+			REQUIRE(expected[v].first == actual[v].first);
+			if(actual[v].first != 0 && actual[v].first != inf<bfs_path_length_t>) {
+				CHECK(actual[actual[v].second].first + 1 == actual[v].first);
+				CHECK(graph.E(actual[v].second, v));
+			}
+		}
+	};
+
+	for(std::size_t threads : { 1, 4 }) {
+		thread_pool pool(threads);
+		check(directed_graph, bfs_shortest_path(directed_graph, 0), parallel_bfs_shortest_path(directed_graph, 0, pool));
+		check(undirected_graph, bfs_shortest_path(undirected_graph, 7), parallel_bfs_shortest_path(undirected_graph, 7, pool));
+
+		const std::vector<vertex_index_t> start = { 3, 5, 3 };
+		check(directed_graph, bfs_shortest_path(directed_graph, start), parallel_bfs_shortest_path(directed_graph, start, pool));
+	}
+	check(undirected_graph, bfs_shortest_path(undirected_graph, 1), parallel_bfs_shortest_path(undirected_graph, 1));
+}
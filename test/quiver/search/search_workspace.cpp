@@ -0,0 +1,88 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include "../random_graphs.hpp"
+#include <vector>
+#include <tuple>
+#include <random>
+
+TEST_CASE("search_workspace", "[quiver][search]")
+{
+	SECTION("marks")
+	{
+		search_workspace<> workspace(4);
+		workspace.set(2);
+		workspace.set(0);
+		workspace.set(2);
+		CHECK(workspace(0));
+		CHECK(!workspace(1));
+		CHECK(workspace(2));
+		REQUIRE(workspace.touched().size() == 2);
+		CHECK(workspace.touched()[0] == 2);
+		CHECK(workspace.touched()[1] == 0);
+
+		workspace.reset();
+		CHECK(!workspace(0));
+		CHECK(!workspace(2));
+		CHECK(workspace.touched().empty());
+
+		workspace.reset(6);
+		CHECK(workspace.size() == 6);
+		workspace.set(5);
+		CHECK(workspace(5));
+
+		std::vector<int>& buffer = workspace.buffer<std::vector<int>>();
+		buffer.push_back(1);
+		CHECK(&workspace.buffer<std::vector<int>>() == &buffer);
+		CHECK(workspace.buffer<std::vector<int>>().size() == 1);
+		CHECK(static_cast<void*>(&workspace.buffer<std::vector<long>>()) != static_cast<void*>(&buffer));
+	}
+	SECTION("searches")
+	{
+		const std::size_t V = 300;
+		const auto graph = random_graph<adjacency_list<directed, wt<int>>>(V, 3 * V, std::uniform_int_distribution<int>(0, 20), 42);
+
+		search_workspace workspace(graph);
+		for(vertex_index_t start : { 0, 17, 0, 123 }) {
+			const auto dense_bfs = bfs_shortest_path(graph, start);
+			const auto sparse_bfs = bfs_shortest_path(graph, start, workspace);
+			std::size_t reached = 0;
+			for(auto const& [distance, predecessor] : dense_bfs)
+				reached += distance != inf<bfs_path_length_t>;
+			CHECK(sparse_bfs.size() == reached);
+			for(auto const& [vertex, distance, predecessor] : sparse_bfs)
+				CHECK(dense_bfs[vertex].first == distance);
+
+			const auto dense_dijkstra = dijkstra_shortest_path(graph, start);
+			const auto sparse_dijkstra = dijkstra_shortest_path(graph, start, workspace);
+			CHECK(sparse_dijkstra.size() == reached);
+			CHECK(workspace.touched().size() == reached);
+			for(auto const& [vertex, distance, predecessor] : sparse_dijkstra) {
+				CHECK(dense_dijkstra[vertex].first == distance);
+				CHECK(workspace(vertex));
+			}
+
+			std::vector<vertex_index_t> expected, actual;
+			dfs(graph, start, [&expected](vertex_index_t index){ expected.push_back(index); return false; });
+			dfs(graph, start, [&actual](vertex_index_t index){ actual.push_back(index); return false; }, workspace);
+			CHECK(expected == actual);
+
+			expected.clear();
+			actual.clear();
+			CHECK(dijkstra(graph, start, [&expected](vertex_index_t index, int){ expected.push_back(index); return expected.size() == 5; }) == (reached >= 5));
+			CHECK(dijkstra(graph, start, [&actual](vertex_index_t index, int){ actual.push_back(index); return actual.size() == 5; }, workspace) == (reached >= 5));
+			CHECK(expected.size() == actual.size());
+
+			std::size_t visits = 0;
+			CHECK(bfs(graph, start, [&visits](vertex_index_t){ ++visits; return false; }, workspace) == false);
+			CHECK(visits == reached);
+		}
+	}
+}
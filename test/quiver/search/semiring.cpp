@@ -0,0 +1,124 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder@protonmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include "../random_graphs.hpp"
+#include <algorithm>
+#include <vector>
+#include <random>
+
+namespace
+{
+	// Relaxes every edge until nothing changes, which terminates for the monotone semirings.
+	template<template<typename> typename semiring_t, typename graph_t>
+	auto fixpoint(graph_t const& graph, vertex_index_t start)
+	{
+		using scalar_t = decltype(graph.V[0].out_edges[0].weight);
+		using semiring = semiring_t<scalar_t>;
+		std::vector<scalar_t> result(graph.V.size(), semiring::zero());
+		result[start] = semiring::one();
+		for(bool changed = true; changed;) {
+			changed = false;
+			for(vertex_index_t from = 0; from < graph.V.size(); ++from)
+				if(result[from] != semiring::zero())
+					for(auto const& edge : graph.V[from].out_edges) {
+						const scalar_t candidate = semiring::extend(result[from], edge.weight);
+						if(semiring::better(candidate, result[edge.to])) {
+							result[edge.to] = candidate;
+							changed = true;
+						}
+					}
+		}
+		return result;
+	}
+
+	// Every reached vertex but start has the distance of its predecessor extended by the best edge between them.
+	template<template<typename> typename semiring_t, typename graph_t, typename result_t>
+	void check_predecessors(graph_t const& graph, vertex_index_t start, result_t const& result)
+	{
+		using scalar_t = decltype(graph.V[0].out_edges[0].weight);
+		using semiring = semiring_t<scalar_t>;
+		for(vertex_index_t index = 0; index < graph.V.size(); ++index) {
+			const auto [distance, predecessor] = result[index];
+			if(index == start || predecessor == ~vertex_index_t{})
+				continue;
+			scalar_t best = semiring::zero();
+			for(auto const& edge : graph.V[predecessor].out_edges)
+				if(edge.to == index && semiring::better(semiring::extend(result[predecessor].first, edge.weight), best))
+					best = semiring::extend(result[predecessor].first, edge.weight);
+			CHECK(best == distance);
+		}
+	}
+}
+
+TEST_CASE("semiring", "[quiver][search]")
+{
+	const std::size_t V = 200;
+
+	SECTION("widest path")
+	{
+		const auto graph = random_graph<adjacency_list<directed, wt<int>>>(V, 5 * V, std::uniform_int_distribution<int>(1, 1000), 20);
+		for(vertex_index_t start : { 0, 17, 101 }) {
+			const auto expected = fixpoint<max_min_semiring>(graph, start);
+			const auto result = widest_path(graph, start);
+			REQUIRE(result.size() == V);
+			CHECK(result[start].first == inf<int>);
+			CHECK(result[start].second == start);
+			for(vertex_index_t index = 0; index < V; ++index) {
+				CHECK(result[index].first == expected[index]);
+				CHECK((result[index].second == ~vertex_index_t{}) == (expected[index] == max_min_semiring<int>::zero()));
+			}
+			check_predecessors<max_min_semiring>(graph, start, result);
+			// ties may pick other predecessors
+			const auto quaternary = widest_path<quaternary_heap>(graph, start);
+			CHECK(std::ranges::equal(quaternary, result, {}, &std::pair<int, vertex_index_t>::first, &std::pair<int, vertex_index_t>::first));
+		}
+
+		// the wide detour beats the narrow direct edge
+		adjacency_list<directed, wt<unsigned>> small(4);
+		small.E.emplace(0, 3, 1u);
+		small.E.emplace(0, 1, 5u);
+		small.E.emplace(1, 2, 7u);
+		small.E.emplace(2, 3, 4u);
+		const auto widest = widest_path(small, 0);
+		CHECK(widest[3].first == 4u);
+		CHECK(widest[3].second == 2);
+		CHECK(widest[1].first == 5u);
+	}
+	SECTION("most reliable path")
+	{
+		const auto graph = random_graph<adjacency_list<directed, wt<double>>>(V, 5 * V, std::uniform_real_distribution<double>(0.5, 1), 21);
+		const auto expected = fixpoint<max_times_semiring>(graph, 3);
+		const auto result = most_reliable_path(graph, 3);
+		CHECK(result[3].first == 1.0);
+		for(vertex_index_t index = 0; index < V; ++index)
+			CHECK(result[index].first == Approx(expected[index]));
+		check_predecessors<max_times_semiring>(graph, 3, result);
+
+		const auto weight = [](vertex_index_t, auto const& edge){ return edge.weight * edge.weight; };
+		const auto squared = most_reliable_path(graph, std::vector<vertex_index_t>{ 3 }, weight);
+		for(vertex_index_t index = 0; index < V; ++index)
+			CHECK(squared[index].first == Approx(result[index].first * result[index].first));
+	}
+	SECTION("min plus")
+	{
+		const auto graph = random_graph<adjacency_list<directed, wt<int>>>(V, 5 * V, std::uniform_int_distribution<int>(0, 100), 22);
+		const auto expected = dijkstra_shortest_path(graph, 0);
+		const auto result = semiring_shortest_path<min_plus_semiring>(graph, 0);
+		for(vertex_index_t index = 0; index < V; ++index)
+			CHECK(result[index].first == expected[index].first);
+		check_predecessors<min_plus_semiring>(graph, 0, result);
+
+		std::size_t visits = 0;
+		visitation_table_t visited(graph);
+		auto visitor = [&visits](vertex_index_t, int, vertex_index_t){ return ++visits == 10; };
+		CHECK(semiring_shortest_path<max_min_semiring>(graph, 0, visited.hook_visitor(visitor), [&visited](vertex_index_t index){ return visited(index); }, dijkstra_default_weight_invokable<decltype(graph)>()) == true);
+		CHECK(visits == 10);
+	}
+}
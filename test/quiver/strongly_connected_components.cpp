@@ -9,6 +9,11 @@
 #include <catch2/catch.hpp>
 #include <quiver.hpp>
 using namespace quiver;
+#include "random_graphs.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
 
 TEST_CASE("strongly_connected_components", "[quiver][fundamentals]")
 {
@@ -67,4 +72,195 @@ TEST_CASE("strongly_connected_components", "[quiver][fundamentals]")
 
 	// 4 components
 	CHECK(max_scc_index == 3);
+
+	CHECK(pearce_iterative(graph) == sccs);
+}
+
+TEST_CASE("pearce_iterative", "[quiver][fundamentals]")
+{
+	SECTION("random")
+	{
+		for(std::size_t V : { 1, 10, 100, 1000 })
+			for(std::size_t density : { 1, 2, 4 }) {
+				const auto graph = random_graph<adjacency_list<directed, void, void>>(V, density * V, 22);
+				CHECK(pearce_iterative(graph) == tarjan_recursive(graph));
+				CHECK(pearce_iterative(csr_graph(graph)) == tarjan_recursive(graph));
+				// narrow indices narrow the state, but not the result
+				const auto narrow = random_graph<adjacency_list<directed, void, void, vector, vector, std::uint32_t>>(V, density * V, 22);
+				CHECK(pearce_iterative(narrow) == tarjan_recursive(graph));
+			}
+		static_assert(sizeof(detail::dfs_compact_frame_type<adjacency_list<directed, void, void, vector, vector, std::uint32_t> const>) == 2 * sizeof(std::uint32_t));
+	}
+	SECTION("deep")
+	{
+		// far deeper than tarjan_recursive could go
+		const std::size_t V = 1'000'000;
+		adjacency_list<directed, void, void> chain(V);
+		for(vertex_index_t i = 0; i + 1 < V; ++i)
+			chain.E.emplace(i, i + 1);
+		const auto components = pearce_iterative(chain);
+		REQUIRE(components.size() == V);
+		// the end of the chain completes first
+		CHECK(components[V - 1] == 0);
+		CHECK(components[0] == V - 1);
+
+		chain.E.emplace(V - 1, 0);
+		const auto cycle = pearce_iterative(chain);
+		CHECK(std::ranges::all_of(cycle, [](std::size_t component){ return component == 0; }));
+	}
+}
+
+namespace
+{
+	// Renumbers the components in the order of their first vertex, so that equal partitions compare equal.
+	std::vector<std::size_t> canonical(std::vector<std::size_t> const& components)
+	{
+		std::vector<std::size_t> renumbered(components.size()), mapping(components.size(), ~std::size_t{});
+		std::size_t next = 0;
+		for(std::size_t index = 0; index < components.size(); ++index) {
+			REQUIRE(components[index] < components.size());
+			if(mapping[components[index]] == ~std::size_t{})
+				mapping[components[index]] = next++;
+			renumbered[index] = mapping[components[index]];
+		}
+		return renumbered;
+	}
+	// The component indices are [0, number of components).
+	bool dense(std::vector<std::size_t> const& components)
+	{
+		return components.empty() || std::ranges::max(components) == std::ranges::max(canonical(components));
+	}
+}
+
+TEST_CASE("parallel_strongly_connected_components", "[quiver][fundamentals]")
+{
+	thread_pool pool(3);
+	SECTION("random")
+	{
+		for(std::size_t V : { 1, 10, 100, 1000, 10000 })
+			for(std::size_t density : { 1, 2, 4 }) {
+				const auto graph = random_graph<adjacency_list<directed, void, void>>(V, density * V, 23);
+				const auto expected = canonical(tarjan_recursive(graph));
+				const auto components = parallel_strongly_connected_components(graph, pool);
+				CHECK(canonical(components) == expected);
+				CHECK(dense(components));
+				CHECK(canonical(parallel_strongly_connected_components(csr_graph(graph), csr_graph(transpose(graph)), pool)) == expected);
+			}
+	}
+	SECTION("giant component")
+	{
+		// one large cycle with chords, plus trees and chains hanging off it and into it
+		const std::size_t cycle = 5000, V = 50000;
+		std::mt19937 engine(24);
+		adjacency_list<directed, void, void> graph(V);
+		for(vertex_index_t i = 0; i < cycle; ++i)
+			graph.E.emplace(i, (i + 1) % cycle);
+		std::uniform_int_distribution<vertex_index_t> cycle_distribution(0, cycle - 1);
+		for(std::size_t i = 0; i < cycle; ++i) {
+			const vertex_index_t from = cycle_distribution(engine), to = cycle_distribution(engine);
+			if(from != to)
+				graph.E.emplace(from, to);
+		}
+		for(vertex_index_t i = cycle; i < V; ++i) {
+			std::uniform_int_distribution<vertex_index_t> earlier(0, i - 1);
+			if(i % 2)
+				graph.E.emplace(earlier(engine), i);
+			else
+				graph.E.emplace(i, earlier(engine));
+		}
+		// a few small cycles among the trivial vertices survive trimming
+		graph.E.emplace(V - 1, V - 3);
+		graph.E.emplace(V - 3, V - 1);
+		graph.E.emplace(V - 2, V - 4);
+		graph.E.emplace(V - 4, V - 6);
+		graph.E.emplace(V - 6, V - 2);
+		const auto components = parallel_strongly_connected_components(graph, pool);
+		CHECK(canonical(components) == canonical(pearce_iterative(graph)));
+		CHECK(dense(components));
+		CHECK(std::ranges::count(components, components[0]) == cycle);
+		// the giant component, the two small cycles of 5 vertices and the trivial components
+		CHECK(std::ranges::max(components) + 1 == 1 + 2 + (V - cycle - 5));
+	}
+	SECTION("single thread")
+	{
+		adjacency_list<directed, void, void> graph(6);
+		graph.E.emplace(0, 1);
+		graph.E.emplace(1, 0);
+		graph.E.emplace(1, 2);
+		graph.E.emplace(2, 3);
+		graph.E.emplace(3, 4);
+		graph.E.emplace(4, 2);
+		thread_pool single(1);
+		const auto components = parallel_strongly_connected_components(graph, single);
+		CHECK(canonical(components) == std::vector<std::size_t>{ 0, 0, 1, 1, 1, 2 });
+		CHECK(parallel_strongly_connected_components(adjacency_list<directed, void, void>(), single).empty());
+	}
+}
+
+TEST_CASE("condense", "[quiver][fundamentals]")
+{
+	SECTION("example")
+	{
+		// three cycles 0 1 2, 3 4 and 5, joined by parallel edges
+		adjacency_list<directed, void, void> graph(6);
+		graph.E.emplace(0, 1);
+		graph.E.emplace(1, 2);
+		graph.E.emplace(2, 0);
+		graph.E.emplace(3, 4);
+		graph.E.emplace(4, 3);
+		graph.E.emplace(0, 3);
+		graph.E.emplace(1, 4);
+		graph.E.emplace(2, 3);
+		graph.E.emplace(3, 5);
+		graph.E.emplace(4, 5);
+		const auto result = condense(graph, true);
+		REQUIRE(result.dag.V.size() == 3);
+		CHECK(result.dag.E.size() == 2);
+		const std::size_t a = result.component[0], b = result.component[3], c = result.component[5];
+		CHECK(result.dag.E(a, b));
+		CHECK(result.dag.E(b, c));
+		CHECK(!result.dag.E(a, c));
+		CHECK(result.sizes[a] == 3);
+		CHECK(result.sizes[b] == 2);
+		CHECK(result.sizes[c] == 1);
+		CHECK(result.members[a] == std::vector<vertex_index_t>{ 0, 1, 2 });
+		CHECK(result.members[b] == std::vector<vertex_index_t>{ 3, 4 });
+		CHECK(result.members[c] == std::vector<vertex_index_t>{ 5 });
+		CHECK(toposort_kahn(result.dag) == std::vector<vertex_index_t>{ a, b, c });
+		CHECK(condense(graph).members.empty());
+		CHECK(condense(adjacency_list<directed, void, void>()).dag.V.size() == 0);
+	}
+	SECTION("random")
+	{
+		const std::size_t V = 2000;
+		const auto graph = random_graph<adjacency_list<directed, void, void>>(V, V, 24);
+		const auto components = tarjan_recursive(graph);
+		const auto result = condense(graph, components, true);
+		REQUIRE(result.dag.V.size() == std::ranges::max(components) + 1);
+		CHECK(result.component == components);
+		std::size_t total = 0;
+		for(std::size_t c = 0; c < result.dag.V.size(); ++c) {
+			CHECK(result.sizes[c] == result.members[c].size());
+			total += result.sizes[c];
+			// edges lead to earlier completed components
+			for(auto const& out_edge : result.dag.V[c].out_edges)
+				CHECK(out_edge.to < c);
+		}
+		CHECK(total == V);
+		// exactly the component pairs joined by an edge
+		std::size_t expected_edges = 0;
+		std::vector<std::size_t> last(result.dag.V.size(), ~std::size_t{});
+		for(std::size_t c = 0; c < result.dag.V.size(); ++c)
+			for(vertex_index_t from : result.members[c])
+				for(auto const& out_edge : graph.V[from].out_edges) {
+					const std::size_t d = components[out_edge.to];
+					if(d != c && last[d] != c) {
+						last[d] = c;
+						++expected_edges;
+						CHECK(result.dag.E(c, d));
+					}
+				}
+		CHECK(result.dag.E.size() == expected_edges);
+		CHECK(toposort_kahn(result.dag).size() == result.dag.V.size());
+	}
 }